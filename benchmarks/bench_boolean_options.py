@@ -0,0 +1,58 @@
+"""Boolean options on coincident-face workloads.
+
+Fuses a grid of unit boxes that share faces with their neighbours (assembly-style input) with
+the default builder and with each ``BooleanOptions`` switch: OBB pre-filtering, the glue modes
+(``shift`` for touching inputs, ``full`` for inputs sharing whole faces) and history off.
+
+    python benchmarks/bench_boolean_options.py [--grid 6] [--repeat 3]
+"""
+
+import argparse
+import time
+
+from compas.geometry import Box
+from compas_occt import _occt
+from compas_occt.brep import OCCBrep
+
+CONFIGS = {
+    "default": {},
+    "obb": {"use_obb": True},
+    "glue shift": {"glue": "shift"},
+    "glue full": {"glue": "full"},
+    "no history": {"fill_history": False},
+    "all": {"use_obb": True, "glue": "full", "non_destructive": True, "fill_history": False},
+}
+
+
+def make_boxes(grid):
+    # every box shares a face with each of its neighbours
+    boxes = [OCCBrep.from_box(Box(1).translated([i, j, k])).occ_shape for i in range(grid) for j in range(grid) for k in range(2)]
+    return boxes[: len(boxes) // 2], boxes[len(boxes) // 2 :]
+
+
+def best_of(grid, options, repeat):
+    best = float("inf")
+    for _ in range(repeat):
+        A, B = make_boxes(grid)
+        start = time.perf_counter()
+        _occt.boolean_union(A, B, 1e-6, None, options)
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--grid", type=int, default=6)
+    parser.add_argument("--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    baseline = None
+    print(f"{'options':>12} {'seconds':>10} {'speedup':>8}")
+    for name, kwargs in CONFIGS.items():
+        elapsed = best_of(args.grid, _occt.BooleanOptions(**kwargs), args.repeat)
+        baseline = baseline or elapsed
+        print(f"{name:>12} {elapsed:>10.3f} {baseline / elapsed:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,58 @@
+"""Serial vs parallel multi-body fuse.
+
+Fuses a grid of overlapping spheres (arguments) with a grid of cylinders (tools) once with
+``parallel=False`` and once with ``parallel=True`` at several OCCT thread-pool sizes.
+
+    python benchmarks/bench_boolean_parallel.py [--grid 6] [--repeat 3]
+"""
+
+import argparse
+import os
+import time
+
+from compas.geometry import Cylinder
+from compas.geometry import Frame
+from compas.geometry import Sphere
+from compas_occt import _occt
+from compas_occt.brep import OCCBrep
+
+
+def make_bodies(grid):
+    spheres = [OCCBrep.from_sphere(Sphere(0.7, point=[i, j, 0])).occ_shape for i in range(grid) for j in range(grid)]
+    cylinders = [OCCBrep.from_cylinder(Cylinder(0.3, 2, frame=Frame([i + 0.5, j + 0.5, 0]))).occ_shape for i in range(grid) for j in range(grid)]
+    return spheres, cylinders
+
+
+def run(grid, parallel, repeat):
+    best = float("inf")
+    for _ in range(repeat):
+        spheres, cylinders = make_bodies(grid)
+        start = time.perf_counter()
+        _occt.boolean_union(spheres, cylinders, 1e-6, parallel)
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--grid", type=int, default=6)
+    parser.add_argument("--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    cores = os.cpu_count() or 1
+    counts = sorted({2, 4, 8, cores} & set(range(2, cores + 1)))
+
+    serial = run(args.grid, False, args.repeat)
+    print(f"{'mode':>12} {'seconds':>10} {'speedup':>8}")
+    print(f"{'serial':>12} {serial:>10.3f} {1.0:>8.2f}")
+    try:
+        for threads in counts:
+            _occt.set_thread_pool_size(threads)
+            elapsed = run(args.grid, True, args.repeat)
+            print(f"{'parallel/' + str(threads):>12} {elapsed:>10.3f} {serial / elapsed:>8.2f}")
+    finally:
+        _occt.set_thread_pool_size(0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,57 @@
+"""Union + difference + intersection of the same operands: one-by-one vs shared intersection.
+
+``OCCBrep.from_boolean_operations`` runs the intersection phase (``BOPAlgo_PaveFiller``) once and
+builds every result from it; the one-by-one constructors redo it for each result.
+
+    python benchmarks/bench_boolean_shared.py [--grid 4] [--repeat 3]
+"""
+
+import argparse
+import time
+
+from compas.geometry import Sphere
+from compas.geometry import Torus
+from compas_occt.brep import OCCBrep
+
+
+def make_operands(grid):
+    part = [OCCBrep.from_sphere(Sphere(0.6, point=[i, j, 0])) for i in range(grid) for j in range(grid)]
+    envelope = [OCCBrep.from_torus(Torus(grid / 2, 0.4).translated([grid / 2 - 0.5, grid / 2 - 0.5, 0]))]
+    return part, envelope
+
+
+def one_by_one(A, B):
+    OCCBrep.from_boolean_union(A, B)
+    OCCBrep.from_boolean_difference(A, B)
+    OCCBrep.from_boolean_intersection(A, B)
+
+
+def shared(A, B):
+    OCCBrep.from_boolean_operations(A, B, ("union", "difference", "intersection"))
+
+
+def best_of(fn, grid, repeat):
+    best = float("inf")
+    for _ in range(repeat):
+        A, B = make_operands(grid)
+        start = time.perf_counter()
+        fn(A, B)
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--grid", type=int, default=4)
+    parser.add_argument("--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    separate = best_of(one_by_one, args.grid, args.repeat)
+    combined = best_of(shared, args.grid, args.repeat)
+    print(f"{'mode':>12} {'seconds':>10} {'speedup':>8}")
+    print(f"{'one-by-one':>12} {separate:>10.3f} {1.0:>8.2f}")
+    print(f"{'shared':>12} {combined:>10.3f} {separate / combined:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
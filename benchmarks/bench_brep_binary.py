@@ -0,0 +1,78 @@
+"""Binary (BinTools) vs text BREP serialisation.
+
+Builds an assembly-like compound of filleted, drilled blocks, meshes it, and times writing and
+reading it as a text BREP file, a binary BREP file, and binary BREP bytes (with and without the
+triangulation), reporting the size of each encoding.
+
+    python benchmarks/bench_brep_binary.py [--grid 6] [--repeat 3]
+"""
+
+import argparse
+import os
+import tempfile
+import time
+
+from compas.geometry import Box
+from compas.geometry import Cylinder
+from compas.geometry import Frame
+from compas_occt import _occt
+from compas_occt.brep import OCCBrep
+
+
+def make_assembly(grid):
+    parts = []
+    for i in range(grid):
+        for j in range(grid):
+            block = OCCBrep.from_box(Box(1, 1, 0.5, frame=Frame([i * 1.5, j * 1.5, 0])))
+            hole = OCCBrep.from_cylinder(Cylinder(0.25, 2, frame=Frame([i * 1.5, j * 1.5, 0])))
+            part = block - hole
+            part.fillet(0.05)
+            parts.append(part.occ_shape)
+    return _occt.compound_from_shapes(parts)
+
+
+def best_of(fn, repeat):
+    best = float("inf")
+    result = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        result = fn()
+        best = min(best, time.perf_counter() - start)
+    return best, result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--grid", type=int, default=6, help="blocks per side of the assembly")
+    parser.add_argument("--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    shape = make_assembly(args.grid)
+    _occt.tesselate(shape, 1e-3, 0.2)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        text_path = os.path.join(tmp, "shape.brep")
+        binary_path = os.path.join(tmp, "shape.bbrep")
+        rows = []
+
+        t_write, _ = best_of(lambda: _occt.write_brep(shape, text_path), args.repeat)
+        t_read, _ = best_of(lambda: _occt.read_brep(text_path), args.repeat)
+        rows.append(("text file", t_write, t_read, os.path.getsize(text_path)))
+
+        t_write, _ = best_of(lambda: _occt.write_brep_binary(shape, binary_path), args.repeat)
+        t_read, _ = best_of(lambda: _occt.read_brep_binary(binary_path), args.repeat)
+        rows.append(("binary file", t_write, t_read, os.path.getsize(binary_path)))
+
+        for triangulation in (False, True):
+            t_write, data = best_of(lambda: _occt.write_brep_binary_bytes(shape, triangulation), args.repeat)
+            t_read, _ = best_of(lambda: _occt.read_brep_binary_bytes(data), args.repeat)
+            rows.append(("binary bytes" + (" + mesh" if triangulation else ""), t_write, t_read, len(data)))
+
+    base_write, base_read = rows[0][1], rows[0][2]
+    print(f"{'encoding':<22}{'write ms':>10}{'read ms':>10}{'size kB':>10}{'write x':>9}{'read x':>9}")
+    for name, t_write, t_read, size in rows:
+        print(f"{name:<22}{t_write * 1e3:>10.2f}{t_read * 1e3:>10.2f}{size / 1024:>10.1f}{base_write / t_write:>9.1f}{base_read / t_read:>9.1f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,54 @@
+"""Concurrent ``tesselate`` calls scaling with the number of Python threads.
+
+The BRepMesh stage of ``_occt.tesselate`` runs with the GIL released, so N threads tessellating
+N distinct shapes should approach an N-fold speedup (up to the core count).
+
+    python benchmarks/bench_tesselate_threads.py [--shapes 32] [--deflection 0.002]
+"""
+
+import argparse
+import os
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+from compas.geometry import Torus
+from compas_occt import _occt
+from compas_occt.brep import OCCBrep
+
+
+def make_shapes(count):
+    # fresh shapes every run: tesselate stores the triangulation on the shape
+    return [OCCBrep.from_torus(Torus(2 + 0.01 * i, 0.5)).occ_shape for i in range(count)]
+
+
+def run(shapes, threads, linear, angular):
+    start = time.perf_counter()
+    if threads == 1:
+        for shape in shapes:
+            _occt.tesselate(shape, linear, angular)
+    else:
+        with ThreadPoolExecutor(max_workers=threads) as pool:
+            list(pool.map(lambda shape: _occt.tesselate(shape, linear, angular), shapes))
+    return time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--shapes", type=int, default=32)
+    parser.add_argument("--deflection", type=float, default=0.002)
+    parser.add_argument("--angular", type=float, default=0.05)
+    args = parser.parse_args()
+
+    cores = os.cpu_count() or 1
+    counts = sorted({1, 2, 4, 8, cores} & set(range(1, cores + 1)))
+
+    baseline = None
+    print(f"{'threads':>8} {'seconds':>10} {'speedup':>8}")
+    for threads in counts:
+        elapsed = run(make_shapes(args.shapes), threads, args.deflection, args.angular)
+        baseline = baseline or elapsed
+        print(f"{threads:>8} {elapsed:>10.3f} {baseline / elapsed:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
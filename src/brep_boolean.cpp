@@ -1,28 +1,73 @@
-// brep_boolean.cpp - boolean / section / split / fillet / offset / overlap free functions.
+// brep_boolean.cpp - boolean / section / contours / split / fillet / offset / overlap free functions.
 // On failure (IsDone() == false) these throw std::runtime_error; the Python layer translates
 // that into BrepBooleanError / BrepFilletError to match compas_occ.
 #include "compas.h"
 #include "occt.h"
+#include "meshing.h"
 
+#include <nanobind/stl/unique_ptr.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
 #include <utility>
 
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Wire.hxx>
 #include <TopoDS_Iterator.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopAbs_ShapeEnum.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <TopTools_HSequenceOfShape.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepTools_WireExplorer.hxx>
+#include <Bnd_Box.hxx>
+#include <BVH_BoxSet.hxx>
+#include <GCPnts_TangentialDeflection.hxx>
+#include <ShapeAnalysis_FreeBounds.hxx>
+#include <Precision.hxx>
+#include <gp.hxx>
+#include <gp_Pln.hxx>
+#include <BRepAlgoAPI_BooleanOperation.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Common.hxx>
 #include <BRepAlgoAPI_Section.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
 #include <BOPAlgo_Splitter.hxx>
+#include <BOPAlgo_GlueEnum.hxx>
 #include <BRepFilletAPI_MakeFillet.hxx>
 #include <BRepOffsetAPI_MakeThickSolid.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepExtrema_OverlapTool.hxx>
 #include <BRepExtrema_ShapeProximity.hxx>
+#include <BRepExtrema_TriangleSet.hxx>
 #include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_Failure.hxx>
+#include <Message_ProgressIndicator.hxx>
+#include <Message_ProgressRange.hxx>
+#include <Message_ProgressScope.hxx>
 #include <TColStd_PackedMapOfInteger.hxx>
 
 static TopTools_ListOfShape to_list(const std::vector<Shape>& shapes) {
@@ -31,43 +76,308 @@ static TopTools_ListOfShape to_list(const std::vector<Shape>& shapes) {
     return L;
 }
 
-static Shape boolean_union(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy) {
-    BRepAlgoAPI_Fuse op;
-    TopTools_ListOfShape LA = to_list(A);
-    TopTools_ListOfShape LB = to_list(B);
-    op.SetArguments(LA);
-    op.SetTools(LB);
-    op.SetFuzzyValue(fuzzy);
-    op.SetRunParallel(Standard_False);
-    op.Build();
-    if (!op.IsDone()) throw std::runtime_error("Boolean fuse operation could not be completed.");
-    return Shape(op.Shape());
+// ---------------------------------------------------------------------------
+// parallel mode
+// ---------------------------------------------------------------------------
+//
+// The boolean builders can run their intersection/building phases on OCCT's thread pool
+// (OSD_ThreadPool::DefaultPool). Off by default -- a single small boolean gains nothing and
+// callers running many booleans from Python threads are already parallel -- but large fuses
+// on many-core machines benefit a lot. Each call may override the module default.
+
+static std::atomic<bool> g_boolean_parallel{false};
+
+static bool run_parallel(std::optional<bool> parallel) { return parallel.value_or(g_boolean_parallel.load()); }
+
+static void set_boolean_parallel(bool parallel) { g_boolean_parallel = parallel; }
+static bool boolean_parallel() { return g_boolean_parallel; }
+
+// Number of worker threads of OCCT's default pool (shared by BOPAlgo, BRepMesh, OSD_Parallel).
+// n <= 0 resets it to the number of logical processors.
+static void set_thread_pool_size(int n) { OSD_ThreadPool::DefaultPool()->Init(n > 0 ? n : -1); }
+static int thread_pool_size() { return OSD_ThreadPool::DefaultPool()->NbThreads(); }
+
+// ---------------------------------------------------------------------------
+// options
+// ---------------------------------------------------------------------------
+
+// Performance switches of the General Fuse family (BRepAlgoAPI_* / BOPAlgo_Splitter / PaveFiller),
+// exposed to Python as `BooleanOptions`. The defaults are OCCT's defaults.
+//   use_obb         prefilter candidate pairs with oriented bounding boxes (fewer exact tests)
+//   glue            BOPAlgo_GlueShift / GlueFull for inputs that only touch / share faces: skips the
+//                   face/face intersection of coincident faces entirely
+//   non_destructive never modify the inputs (copies sub-shapes whose tolerance must grow)
+//   fill_history    record Modified/Generated/IsDeleted (skip it when only the result is needed)
+struct BooleanOptions {
+    bool use_obb = false;
+    BOPAlgo_GlueEnum glue = BOPAlgo_GlueOff;
+    bool non_destructive = false;
+    bool fill_history = true;
+};
+
+static BOPAlgo_GlueEnum glue_from_string(const std::string& glue) {
+    if (glue == "off") return BOPAlgo_GlueOff;
+    if (glue == "shift") return BOPAlgo_GlueShift;
+    if (glue == "full") return BOPAlgo_GlueFull;
+    throw std::invalid_argument("BooleanOptions: glue must be 'off', 'shift' or 'full', not '" + glue + "'.");
+}
+
+static std::string glue_to_string(BOPAlgo_GlueEnum glue) {
+    switch (glue) {
+        case BOPAlgo_GlueShift: return "shift";
+        case BOPAlgo_GlueFull: return "full";
+        default: return "off";
+    }
 }
 
-static Shape boolean_difference(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy) {
-    BRepAlgoAPI_Cut op;
+// Works for BRepAlgoAPI_BuilderAlgo subclasses and BOPAlgo_Splitter alike.
+template <typename Algo>
+static void apply_options(Algo& algo, const BooleanOptions& options) {
+    algo.SetUseOBB(options.use_obb);
+    algo.SetGlue(options.glue);
+    algo.SetNonDestructive(options.non_destructive);
+    algo.SetToFillHistory(options.fill_history);
+}
+
+// BRepAlgoAPI_Fuse / _Cut / _Common share their whole set-up; `what` names the operation in errors.
+static void run_boolean(BRepAlgoAPI_BooleanOperation& op, const std::vector<Shape>& A, const std::vector<Shape>& B,
+                        double fuzzy, bool parallel, const BooleanOptions& options, const char* what,
+                        const Message_ProgressRange& range = Message_ProgressRange()) {
     TopTools_ListOfShape LA = to_list(A);
     TopTools_ListOfShape LB = to_list(B);
     op.SetArguments(LA);
     op.SetTools(LB);
     op.SetFuzzyValue(fuzzy);
-    op.SetRunParallel(Standard_False);
-    op.Build();
-    if (!op.IsDone()) throw std::runtime_error("Boolean difference operation could not be completed.");
-    return Shape(op.Shape());
+    op.SetRunParallel(parallel);
+    apply_options(op, options);
+    op.Build(range);
+    if (!op.IsDone()) throw std::runtime_error(std::string("Boolean ") + what + " operation could not be completed.");
+}
+
+template <typename Op>
+static TopoDS_Shape build_boolean(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy,
+                                  bool parallel, const BooleanOptions& options, const char* what,
+                                  const Message_ProgressRange& range = Message_ProgressRange()) {
+    Op op;
+    run_boolean(op, A, B, fuzzy, parallel, options, what, range);
+    return op.Shape();
 }
 
-static Shape boolean_intersection(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy) {
-    BRepAlgoAPI_Common op;
+static Shape boolean_union(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy,
+                           std::optional<bool> parallel, std::optional<BooleanOptions> options) {
+    return Shape(build_boolean<BRepAlgoAPI_Fuse>(A, B, fuzzy, run_parallel(parallel), options.value_or(BooleanOptions{}), "fuse"));
+}
+
+static Shape boolean_difference(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy,
+                                std::optional<bool> parallel, std::optional<BooleanOptions> options) {
+    return Shape(build_boolean<BRepAlgoAPI_Cut>(A, B, fuzzy, run_parallel(parallel), options.value_or(BooleanOptions{}), "difference"));
+}
+
+static Shape boolean_intersection(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy,
+                                  std::optional<bool> parallel, std::optional<BooleanOptions> options) {
+    return Shape(build_boolean<BRepAlgoAPI_Common>(A, B, fuzzy, run_parallel(parallel), options.value_or(BooleanOptions{}), "intersection"));
+}
+
+// ---------------------------------------------------------------------------
+// several results from one intersection pass
+// ---------------------------------------------------------------------------
+
+// Several booleans of the same operands -> one Shape per entry of `operations` ("union",
+// "difference" (A - B), "intersection", "section"), in that order.
+// The intersection phase (BOPAlgo_PaveFiller over A + B) dominates a boolean and does not depend on
+// the operation, so it runs once; each result is then only a building pass of a BRepAlgoAPI_*
+// constructed on that PaveFiller.
+static std::vector<Shape> boolean_operations(const std::vector<Shape>& A, const std::vector<Shape>& B,
+                                             const std::vector<std::string>& operations, double fuzzy,
+                                             std::optional<bool> parallel, std::optional<BooleanOptions> options) {
+    const BooleanOptions opts = options.value_or(BooleanOptions{});
+    for (const auto& op : operations)
+        if (op != "union" && op != "difference" && op != "intersection" && op != "section")
+            throw std::invalid_argument("boolean_operations: unknown operation '" + op + "' (expected union, difference, intersection or section).");
+
     TopTools_ListOfShape LA = to_list(A);
     TopTools_ListOfShape LB = to_list(B);
-    op.SetArguments(LA);
-    op.SetTools(LB);
-    op.SetFuzzyValue(fuzzy);
-    op.SetRunParallel(Standard_False);
-    op.Build();
-    if (!op.IsDone()) throw std::runtime_error("Boolean intersection operation could not be completed.");
-    return Shape(op.Shape());
+    TopTools_ListOfShape arguments;
+    for (TopTools_ListOfShape::Iterator it(LA); it.More(); it.Next()) arguments.Append(it.Value());
+    for (TopTools_ListOfShape::Iterator it(LB); it.More(); it.Next()) arguments.Append(it.Value());
+
+    BOPAlgo_PaveFiller filler;
+    filler.SetArguments(arguments);
+    filler.SetFuzzyValue(fuzzy);
+    filler.SetRunParallel(run_parallel(parallel));
+    filler.SetUseOBB(opts.use_obb);
+    filler.SetGlue(opts.glue);
+    filler.SetNonDestructive(opts.non_destructive);
+    filler.Perform();
+    if (filler.HasErrors()) throw std::runtime_error("Boolean intersection phase could not be completed.");
+
+    auto build = [&](BRepAlgoAPI_BooleanOperation& op, const std::string& what) {
+        op.SetArguments(LA);
+        op.SetTools(LB);
+        op.SetRunParallel(run_parallel(parallel));
+        op.SetToFillHistory(opts.fill_history);
+        op.Build();
+        if (!op.IsDone()) throw std::runtime_error("Boolean " + what + " operation could not be completed.");
+        return Shape(op.Shape());
+    };
+
+    std::vector<Shape> out;
+    out.reserve(operations.size());
+    for (const auto& op : operations) {
+        if (op == "union") {
+            BRepAlgoAPI_Fuse fuse(filler);
+            out.push_back(build(fuse, "fuse"));
+        } else if (op == "difference") {
+            BRepAlgoAPI_Cut cut(filler);
+            out.push_back(build(cut, "difference"));
+        } else if (op == "intersection") {
+            BRepAlgoAPI_Common common(filler);
+            out.push_back(build(common, "intersection"));
+        } else {
+            BRepAlgoAPI_Section section(filler);
+            out.push_back(build(section, "section"));
+        }
+    }
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// batch
+// ---------------------------------------------------------------------------
+
+// (op, arguments, tools, fuzzy) with op one of "union", "difference", "intersection".
+using BooleanJob = std::tuple<std::string, std::vector<Shape>, std::vector<Shape>, double>;
+// (result or None, error message or "")
+using BooleanJobResult = std::pair<std::optional<Shape>, std::string>;
+
+// Run many independent booleans in one call -> one (shape, error) per job, in job order.
+// The jobs are distributed over OCCT's thread pool (GIL released); each job runs serially
+// inside (the parallelism is across jobs) and non-destructively, since jobs commonly share an
+// input (e.g. one plate minus many hole patterns). A failing job does not abort the batch: its
+// shape is None and its error carries the message. `options` apply to every job (non_destructive
+// is always on).
+static std::vector<BooleanJobResult> boolean_batch(const std::vector<BooleanJob>& jobs, std::optional<BooleanOptions> options) {
+    BooleanOptions opts = options.value_or(BooleanOptions{});
+    opts.non_destructive = true;
+    enum class Kind { Fuse, Cut, Common };
+    std::vector<Kind> kinds;
+    kinds.reserve(jobs.size());
+    for (const auto& job : jobs) {
+        const std::string& op = std::get<0>(job);
+        if (op == "union") kinds.push_back(Kind::Fuse);
+        else if (op == "difference") kinds.push_back(Kind::Cut);
+        else if (op == "intersection") kinds.push_back(Kind::Common);
+        else throw std::invalid_argument("boolean_batch: unknown operation '" + op + "' (expected union, difference or intersection).");
+    }
+
+    std::vector<TopoDS_Shape> shapes(jobs.size());
+    std::vector<std::string> errors(jobs.size());
+    OSD_Parallel::For(0, static_cast<int>(jobs.size()), [&](int i) {
+        const auto& [op, A, B, fuzzy] = jobs[i];
+        try {
+            switch (kinds[i]) {
+                case Kind::Fuse: shapes[i] = build_boolean<BRepAlgoAPI_Fuse>(A, B, fuzzy, false, opts, "fuse"); break;
+                case Kind::Cut: shapes[i] = build_boolean<BRepAlgoAPI_Cut>(A, B, fuzzy, false, opts, "difference"); break;
+                case Kind::Common: shapes[i] = build_boolean<BRepAlgoAPI_Common>(A, B, fuzzy, false, opts, "intersection"); break;
+            }
+        } catch (const Standard_Failure& e) {
+            errors[i] = std::string("Boolean ") + op + " failed: " + e.GetMessageString();
+        } catch (const std::exception& e) {
+            errors[i] = e.what();
+        }
+    });
+
+    std::vector<BooleanJobResult> out;
+    out.reserve(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        if (errors[i].empty()) out.emplace_back(Shape(shapes[i]), std::string());
+        else out.emplace_back(std::nullopt, errors[i]);
+    }
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// history
+// ---------------------------------------------------------------------------
+
+// CSR "input face -> output faces" arrays for one relation (Modified or Generated) of a boolean.
+struct FaceHistory {
+    std::vector<int> offsets{0};
+    std::vector<int> ids;
+};
+
+// A boolean plus its face history, for carrying colours / names / attributes through it:
+//   shape              the result (not healed, so its faces are exactly the ones indexed below)
+//   faces, offsets     output faces of input face f (faces of A, then of B, each in
+//                      TopExp_Explorer(FACE) order): faces[offsets[f]:offsets[f+1]], indices into the
+//                      result's TopExp_Explorer(FACE) order -- its Modified images, or the face
+//                      itself when it passed through unchanged
+//   generated, generated_offsets   output faces Generated from input face f (same layout)
+//   deleted            input faces with no trace in the result
+// Every lookup goes through an indexed map of the result's faces, so the export is linear.
+static nb::dict boolean_with_history(const std::string& operation, const std::vector<Shape>& A, const std::vector<Shape>& B,
+                                     double fuzzy, std::optional<bool> parallel, std::optional<BooleanOptions> options) {
+    std::unique_ptr<BRepAlgoAPI_BooleanOperation> op;
+    if (operation == "union") op = std::make_unique<BRepAlgoAPI_Fuse>();
+    else if (operation == "difference") op = std::make_unique<BRepAlgoAPI_Cut>();
+    else if (operation == "intersection") op = std::make_unique<BRepAlgoAPI_Common>();
+    else throw std::invalid_argument("boolean_with_history: unknown operation '" + operation + "' (expected union, difference or intersection).");
+
+    BooleanOptions opts = options.value_or(BooleanOptions{});
+    opts.fill_history = true;
+
+    TopoDS_Shape shape;
+    FaceHistory modified, generated;
+    std::vector<int> deleted;
+    {
+        nb::gil_scoped_release release;
+        run_boolean(*op, A, B, fuzzy, run_parallel(parallel), opts, operation.c_str());
+        shape = op->Shape();
+
+        // output face -> its index in TopExp_Explorer order (IndexedMap keeps the first occurrence)
+        TopTools_IndexedMapOfShape result;
+        for (TopExp_Explorer ex(shape, TopAbs_FACE); ex.More(); ex.Next()) result.Add(ex.Current());
+        std::vector<int> order(result.Extent());
+        {
+            int position = 0;
+            TopTools_MapOfShape seen;
+            for (TopExp_Explorer ex(shape, TopAbs_FACE); ex.More(); ex.Next(), ++position)
+                if (seen.Add(ex.Current())) order[result.FindIndex(ex.Current()) - 1] = position;
+        }
+        auto append = [&](FaceHistory& h, const TopTools_ListOfShape& images) {
+            for (TopTools_ListIteratorOfListOfShape it(images); it.More(); it.Next())
+                if (it.Value().ShapeType() == TopAbs_FACE)
+                    if (const int index = result.FindIndex(it.Value())) h.ids.push_back(order[index - 1]);
+        };
+
+        int f = 0;
+        for (const std::vector<Shape>* inputs : {&A, &B}) {
+            for (const Shape& input : *inputs) {
+                for (TopExp_Explorer ex(input.shape, TopAbs_FACE); ex.More(); ex.Next(), ++f) {
+                    const TopoDS_Shape& face = ex.Current();
+                    const TopTools_ListOfShape& images = op->Modified(face);
+                    if (!images.IsEmpty()) append(modified, images);
+                    else if (const int index = result.FindIndex(face)) modified.ids.push_back(order[index - 1]);
+                    else if (op->IsDeleted(face)) deleted.push_back(f);
+                    modified.offsets.push_back(static_cast<int>(modified.ids.size()));
+                    append(generated, op->Generated(face));
+                    generated.offsets.push_back(static_cast<int>(generated.ids.size()));
+                }
+            }
+        }
+    }
+    const size_t F = modified.offsets.size() - 1;
+    const size_t M = modified.ids.size();
+    const size_t G = generated.ids.size();
+    const size_t D = deleted.size();
+    nb::dict out;
+    out["shape"] = Shape(shape);
+    out["faces"] = to_numpy(std::move(modified.ids), {M});
+    out["offsets"] = to_numpy(std::move(modified.offsets), {F + 1});
+    out["generated"] = to_numpy(std::move(generated.ids), {G});
+    out["generated_offsets"] = to_numpy(std::move(generated.offsets), {F + 1});
+    out["deleted"] = to_numpy(std::move(deleted), {D});
+    return out;
 }
 
 // Returns the section shape (an edge/wire compound) or throws if not done.
@@ -78,12 +388,189 @@ static Shape section(const Shape& a, const Shape& b) {
     return Shape(op.Shape());
 }
 
-// Split `arguments` by `tools`; expands the resulting compound into a flat list (matching occ.split_shapes).
-static std::vector<Shape> split(const std::vector<Shape>& arguments, const std::vector<Shape>& tools) {
-    BOPAlgo_Splitter splitter;
+// ---------------------------------------------------------------------------
+// contours (multi-plane sections)
+// ---------------------------------------------------------------------------
+
+using PlaneArray = nb::ndarray<const double, nb::shape<-1, 3>, nb::c_contig, nb::device::cpu>;
+
+// Append the points of `wire` (edges in connection order, each discretised within linear/angular)
+// to `points`, without repeating the shared point of consecutive edges.
+static void wire_points(const TopoDS_Wire& wire, double linear, double angular, std::vector<double>& points) {
+    bool first = true;
+    for (BRepTools_WireExplorer ex(wire); ex.More(); ex.Next()) {
+        const TopoDS_Edge& edge = ex.Current();
+        if (BRep_Tool::Degenerated(edge)) continue;
+        BRepAdaptor_Curve curve(edge);
+        GCPnts_TangentialDeflection discretizer(curve, angular, linear);
+        const int n = discretizer.NbPoints();
+        const bool reversed = edge.Orientation() == TopAbs_REVERSED;
+        for (int k = first ? 1 : 2; k <= n; ++k) {
+            const gp_Pnt p = discretizer.Value(reversed ? n + 1 - k : k);
+            points.push_back(p.X());
+            points.push_back(p.Y());
+            points.push_back(p.Z());
+        }
+        first = false;
+    }
+}
+
+using FaceBoxes = BVH_BoxSet<double, 3, int>;
+
+// Elements of `boxes` (face indices) whose bounding box straddles `plane` within `tolerance`;
+// `tree` is the BVH of `boxes`.
+// A node is entered only if its box straddles the plane: its signed distance range along the normal
+// is the centre distance +- the projected half extents.
+static void faces_near_plane(const FaceBoxes& boxes, const BVH_Tree<double, 3>& tree, const gp_Pln& plane, double tolerance,
+                             std::vector<int>& out) {
+    if (tree.Length() == 0) return;
+    const gp_XYZ origin = plane.Location().XYZ();
+    const gp_XYZ normal = plane.Axis().Direction().XYZ();
+    auto straddles = [&](const BVH_Vec3d& lo, const BVH_Vec3d& hi) {
+        const gp_XYZ centre(0.5 * (lo.x() + hi.x()), 0.5 * (lo.y() + hi.y()), 0.5 * (lo.z() + hi.z()));
+        const double d = (centre - origin).Dot(normal);
+        const double r = 0.5 * (std::abs(normal.X()) * (hi.x() - lo.x()) + std::abs(normal.Y()) * (hi.y() - lo.y()) +
+                                std::abs(normal.Z()) * (hi.z() - lo.z()));
+        return d - r <= tolerance && d + r >= -tolerance;
+    };
+    std::vector<int> stack{0};
+    while (!stack.empty()) {
+        const int node = stack.back();
+        stack.pop_back();
+        if (!straddles(tree.MinPoint(node), tree.MaxPoint(node))) continue;
+        if (tree.IsOuter(node)) {
+            for (int k = tree.BegPrimitive(node); k <= tree.EndPrimitive(node); ++k) {
+                const BVH_Box<double, 3> box = boxes.Box(k);
+                if (straddles(box.CornerMin(), box.CornerMax())) out.push_back(boxes.Element(k));
+            }
+        } else {
+            stack.push_back(tree.Child<0>(node));
+            stack.push_back(tree.Child<1>(node));
+        }
+    }
+}
+
+// Section `shape` with many planes -> (points (N,3) float64, offsets (L+1,) int32, plane_ids (L,) int32):
+// polyline l is points[offsets[l]:offsets[l+1]] and lies in plane plane_ids[l] (ascending).
+// The face bounding boxes are put into one BVH, built once and shared by all planes, so each plane
+// only visits the tree nodes it crosses and sections the faces whose box it straddles; the planes
+// are then processed in parallel on OCCT's thread pool with the GIL released (non-destructive
+// sections, so the shared faces are never modified). The section edges of a plane are chained into
+// wires (ShapeAnalysis_FreeBounds) and discretised within linear/angular; closed contours repeat
+// their first point at the end. A plane whose section fails raises (naming the plane) rather than
+// coming back empty.
+static nb::tuple contours(const Shape& s, const PlaneArray& origins, const PlaneArray& normals, double linear, double angular) {
+    if (origins.shape(0) != normals.shape(0)) throw std::invalid_argument("contours: origins and normals must have the same length.");
+    const int P = static_cast<int>(origins.shape(0));
+    const double* o = origins.data();
+    const double* n = normals.data();
+    for (int i = 0; i < P; ++i)
+        if (gp_Vec(n[i * 3], n[i * 3 + 1], n[i * 3 + 2]).Magnitude() <= gp::Resolution())
+            throw std::invalid_argument("contours: plane normals must not be zero.");
+
+    std::vector<double> points;
+    std::vector<int> offsets{0};
+    std::vector<int> plane_ids;
+    {
+        nb::gil_scoped_release release;
+
+        // shared face index: BVH over the face bounding boxes
+        std::vector<TopoDS_Face> faces;
+        FaceBoxes boxes;
+        for (TopExp_Explorer ex(s.shape, TopAbs_FACE); ex.More(); ex.Next()) {
+            Bnd_Box box;
+            BRepBndLib::Add(ex.Current(), box, Standard_False);
+            if (box.IsVoid()) continue;
+            double x0, y0, z0, x1, y1, z1;
+            box.Get(x0, y0, z0, x1, y1, z1);
+            boxes.Add(static_cast<int>(faces.size()), BVH_Box<double, 3>(BVH_Vec3d(x0, y0, z0), BVH_Vec3d(x1, y1, z1)));
+            faces.push_back(TopoDS::Face(ex.Current()));
+        }
+        boxes.MarkDirty();
+        const opencascade::handle<BVH_Tree<double, 3>> tree = boxes.BVH();  // build now, then only read
+
+        std::vector<std::vector<double>> plane_points(P);
+        std::vector<std::vector<int>> plane_offsets(P);  // polyline end offsets, local to the plane
+        std::vector<std::string> errors(P);
+        auto section_plane = [&](int i) {
+            const gp_Pln plane(gp_Pnt(o[i * 3], o[i * 3 + 1], o[i * 3 + 2]), gp_Dir(n[i * 3], n[i * 3 + 1], n[i * 3 + 2]));
+            const double tolerance = Precision::Confusion();
+
+            std::vector<int> near;
+            faces_near_plane(boxes, *tree, plane, tolerance, near);
+            if (near.empty()) return;
+            std::sort(near.begin(), near.end());  // explorer order, whatever the tree layout
+            BRep_Builder builder;
+            TopoDS_Compound candidates;
+            builder.MakeCompound(candidates);
+            for (int f : near) builder.Add(candidates, faces[f]);
+
+            BRepAlgoAPI_Section section(candidates, plane, Standard_False);
+            section.SetNonDestructive(Standard_True);
+            section.SetToFillHistory(Standard_False);
+            section.Build();
+            if (!section.IsDone()) throw std::runtime_error("section could not be completed");
+
+            opencascade::handle<TopTools_HSequenceOfShape> edges = new TopTools_HSequenceOfShape();
+            for (TopExp_Explorer ex(section.Shape(), TopAbs_EDGE); ex.More(); ex.Next()) edges->Append(ex.Current());
+            if (edges->IsEmpty()) return;
+            opencascade::handle<TopTools_HSequenceOfShape> wires;
+            ShapeAnalysis_FreeBounds::ConnectEdgesToWires(edges, tolerance * 10, Standard_False, wires);
+
+            for (int w = 1; w <= wires->Length(); ++w) {
+                const size_t before = plane_points[i].size();
+                wire_points(TopoDS::Wire(wires->Value(w)), linear, angular, plane_points[i]);
+                if (plane_points[i].size() - before < 6) {  // fewer than 2 points
+                    plane_points[i].resize(before);
+                    continue;
+                }
+                plane_offsets[i].push_back(static_cast<int>(plane_points[i].size() / 3));
+            }
+        };
+        OSD_Parallel::For(0, P, [&](int i) {
+            try {
+                section_plane(i);
+            } catch (const Standard_Failure& e) {
+                errors[i] = e.GetMessageString();
+                if (errors[i].empty()) errors[i] = "OCCT failure";
+            } catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+        });
+        for (int i = 0; i < P; ++i)
+            if (!errors[i].empty()) throw std::runtime_error("contours: plane " + std::to_string(i) + ": " + errors[i]);
+
+        for (int i = 0; i < P; ++i) {
+            const int base = offsets.back();
+            for (int end : plane_offsets[i]) {
+                offsets.push_back(base + end);
+                plane_ids.push_back(i);
+            }
+            points.insert(points.end(), plane_points[i].begin(), plane_points[i].end());
+        }
+    }
+    const size_t N = points.size() / 3;
+    const size_t L = plane_ids.size();
+    return nb::make_tuple(to_numpy(std::move(points), {N, 3}), to_numpy(std::move(offsets), {L + 1}),
+                          to_numpy(std::move(plane_ids), {L}));
+}
+
+static void run_splitter(BOPAlgo_Splitter& splitter, const std::vector<Shape>& arguments, const std::vector<Shape>& tools,
+                         double fuzzy, bool parallel, const BooleanOptions& options) {
     for (const auto& s : arguments) splitter.AddArgument(s.shape);
     for (const auto& s : tools) splitter.AddTool(s.shape);
+    splitter.SetFuzzyValue(fuzzy);
+    splitter.SetRunParallel(parallel);
+    apply_options(splitter, options);
     splitter.Perform();
+    if (splitter.HasErrors()) throw std::runtime_error("Split operation could not be completed.");
+}
+
+// Split `arguments` by `tools`; expands the resulting compound into a flat list (matching occ.split_shapes).
+static std::vector<Shape> split(const std::vector<Shape>& arguments, const std::vector<Shape>& tools, double fuzzy,
+                                std::optional<bool> parallel, std::optional<BooleanOptions> options) {
+    BOPAlgo_Splitter splitter;
+    run_splitter(splitter, arguments, tools, fuzzy, run_parallel(parallel), options.value_or(BooleanOptions{}));
     TopoDS_Shape shape = splitter.Shape();
     std::vector<Shape> out;
     if (shape.ShapeType() == TopAbs_COMPOUND) {
@@ -94,16 +581,109 @@ static std::vector<Shape> split(const std::vector<Shape>& arguments, const std::
     return out;
 }
 
+// Record the argument index of every piece that `shape` (argument `source`, or part of a compound
+// argument) became: its Modified images, or itself when it was kept unchanged.
+static void bind_sources(BOPAlgo_Splitter& splitter, const TopoDS_Shape& shape, int source,
+                         TopTools_DataMapOfShapeInteger& sources) {
+    if (shape.ShapeType() == TopAbs_COMPOUND) {
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) bind_sources(splitter, it.Value(), source, sources);
+        return;
+    }
+    const TopTools_ListOfShape& images = splitter.Modified(shape);
+    if (images.IsEmpty()) {
+        if (!splitter.IsDeleted(shape)) sources.Bind(shape, source);
+        return;
+    }
+    for (TopTools_ListIteratorOfListOfShape it(images); it.More(); it.Next()) sources.Bind(it.Value(), source);
+}
+
+static void collect_pieces(const TopoDS_Shape& shape, const TopTools_DataMapOfShapeInteger& sources,
+                           std::vector<Shape>& pieces, std::vector<int>& ids) {
+    if (const int* source = sources.Seek(shape)) {
+        pieces.push_back(Shape(shape));
+        ids.push_back(*source);
+    } else if (shape.ShapeType() == TopAbs_COMPOUND) {
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) collect_pieces(it.Value(), sources, pieces, ids);
+    } else {
+        pieces.push_back(Shape(shape));
+        ids.push_back(-1);
+    }
+}
+
+// Split `arguments` by `tools` -> (pieces, sources): sources[k] is the index of the argument that
+// pieces[k] was cut from. The association comes from the splitter history (one hashed lookup per
+// piece) rather than geometric re-matching, so history is always filled regardless of `options`.
+static std::pair<std::vector<Shape>, std::vector<int>> split_grouped(const std::vector<Shape>& arguments,
+                                                                   const std::vector<Shape>& tools, double fuzzy,
+                                                                   std::optional<bool> parallel,
+                                                                   std::optional<BooleanOptions> options) {
+    BooleanOptions opts = options.value_or(BooleanOptions{});
+    opts.fill_history = true;
+    BOPAlgo_Splitter splitter;
+    run_splitter(splitter, arguments, tools, fuzzy, run_parallel(parallel), opts);
+
+    TopTools_DataMapOfShapeInteger sources;
+    for (size_t i = 0; i < arguments.size(); ++i) bind_sources(splitter, arguments[i].shape, static_cast<int>(i), sources);
+
+    std::vector<Shape> pieces;
+    std::vector<int> ids;
+    const TopoDS_Shape& shape = splitter.Shape();
+    if (shape.ShapeType() == TopAbs_COMPOUND) {
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) collect_pieces(it.Value(), sources, pieces, ids);
+    } else {
+        collect_pieces(shape, sources, pieces, ids);
+    }
+    return {pieces, ids};
+}
+
+// Every edge of `shape` except `exclude`, with one radius. The edges come from an indexed map (each
+// shared edge once) and the exclusions from a hashed map, so the selection is linear in the edges.
+static TopoDS_Shape build_fillet(const TopoDS_Shape& shape, double radius, const std::vector<Shape>& exclude,
+                                 const Message_ProgressRange& range = Message_ProgressRange()) {
+    TopTools_IndexedMapOfShape edges;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+    TopTools_MapOfShape excluded;
+    for (const auto& e : exclude) excluded.Add(e.shape);
+
+    BRepFilletAPI_MakeFillet builder(shape);
+    for (int i = 1; i <= edges.Extent(); ++i) {
+        if (excluded.Contains(edges(i))) continue;
+        builder.Add(radius, TopoDS::Edge(edges(i)));
+    }
+    builder.Build(range);
+    if (!builder.IsDone()) throw std::runtime_error("Fillet operation could not be completed.");
+    return builder.Shape();
+}
+
 static Shape fillet(const Shape& s, double radius, const std::vector<Shape>& exclude) {
+    return Shape(build_fillet(s.shape, radius, exclude));
+}
+
+using EdgeIndexArray = nb::ndarray<const int32_t, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+using RadiusArray = nb::ndarray<const double, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+
+// Fillet only the edges `edges` (indices into shape_map(shape, EDGE)), edge k with radius radii[k], or
+// with a radius varying linearly from radii[k] to end_radii[k] along the edge. A single radius (or end
+// radius) applies to every edge.
+static Shape fillet_indexed(const Shape& s, const EdgeIndexArray& edges, const RadiusArray& radii,
+                            std::optional<RadiusArray> end_radii) {
+    const size_t n = edges.shape(0);
+    auto radius_at = [n](const RadiusArray& r, size_t k, const char* name) {
+        if (r.shape(0) != 1 && r.shape(0) != n)
+            throw std::invalid_argument(std::string("fillet_indexed: ") + name + " must have one value or one per edge.");
+        return r.data()[r.shape(0) == 1 ? 0 : k];
+    };
+
+    TopTools_IndexedMapOfShape map;
+    TopExp::MapShapes(s.shape, TopAbs_EDGE, map);
     BRepFilletAPI_MakeFillet builder(s.shape);
-    for (TopExp_Explorer explorer(s.shape, TopAbs_EDGE); explorer.More(); explorer.Next()) {
-        const TopoDS_Shape& edge = explorer.Current();
-        bool skip = false;
-        for (const auto& e : exclude) {
-            if (e.shape.IsSame(edge)) { skip = true; break; }
-        }
-        if (skip) continue;
-        builder.Add(radius, TopoDS::Edge(edge));
+    for (size_t k = 0; k < n; ++k) {
+        const int index = edges.data()[k];
+        if (index < 0 || index >= map.Extent()) throw std::invalid_argument("fillet_indexed: edge index out of range.");
+        const TopoDS_Edge& edge = TopoDS::Edge(map(index + 1));
+        const double r1 = radius_at(radii, k, "radii");
+        if (end_radii) builder.Add(r1, radius_at(*end_radii, k, "end_radii"), edge);
+        else builder.Add(r1, edge);
     }
     builder.Build();
     if (!builder.IsDone()) throw std::runtime_error("Fillet operation could not be completed.");
@@ -116,19 +696,19 @@ static Shape offset(const Shape& s, double distance) {
     return Shape(builder.Shape());
 }
 
+using ProxMap = NCollection_DataMap<int, TColStd_PackedMapOfInteger>;
+
 // (faces_on_self, faces_on_other) that overlap within tolerance.
 // In OCCT 8.0, OverlapSubShapes1/2() return NCollection_DataMap<int, TColStd_PackedMapOfInteger>
 // (the BRepExtrema_MapOfIntegerPackedMapOfInteger typedef was removed) and GetSubShape1/2 return
 // a TopoDS_Shape.
 static std::pair<std::vector<Shape>, std::vector<Shape>> overlap(
     const Shape& a, const Shape& b, double linear, double angular, bool relative, double tolerance) {
-    using ProxMap = NCollection_DataMap<int, TColStd_PackedMapOfInteger>;
 
-    // The 5-arg constructor already meshes the shape (it auto-calls Perform), so an explicit
-    // Perform() here would triangulate each shape a second time. Constructing the meshers is
-    // enough; the triangulation is stored on the shape for BRepExtrema_ShapeProximity to use.
-    BRepMesh_IncrementalMesh mesher1(a.shape, linear, relative, angular, Standard_False);
-    BRepMesh_IncrementalMesh mesher2(b.shape, linear, relative, angular, Standard_False);
+    // The triangulation is stored on the shape for BRepExtrema_ShapeProximity to use; shapes
+    // that were already meshed finely enough (e.g. by a previous overlap) are not meshed again.
+    mesh_shape(a.shape, linear, angular, relative, false);
+    mesh_shape(b.shape, linear, angular, relative, false);
 
     BRepExtrema_ShapeProximity proximity(a.shape, b.shape, tolerance);
     proximity.Perform();
@@ -148,17 +728,387 @@ static std::pair<std::vector<Shape>, std::vector<Shape>> overlap(
     return {faces1, faces2};
 }
 
+// ---------------------------------------------------------------------------
+// proximity index (repeated overlap queries against one fixed shape)
+// ---------------------------------------------------------------------------
+//
+// overlap() meshes both shapes and builds both BVHs on every call. ProximityIndex does the fixed
+// side once: the shape is meshed, its faces' triangles are copied into a BRepExtrema_TriangleSet
+// and the BVH is built upfront, so every query only pays for the candidate's triangle set and the
+// pair traversal. The set owns its triangle coordinates, so re-meshing the fixed shape later does
+// not affect the index, and after the eager BVH build it is only read -> queries may run
+// concurrently. Face indices follow TopExp_Explorer(FACE) order, i.e. OCCBrep.faces.
+
+static opencascade::handle<BRepExtrema_TriangleSet> triangle_set(const std::vector<TopoDS_Face>& faces) {
+    BRepExtrema_ShapeList list;
+    for (const TopoDS_Face& face : faces) list.Append(face);
+    opencascade::handle<BRepExtrema_TriangleSet> set = new BRepExtrema_TriangleSet(list);
+    set->BVH();  // build now, not lazily inside a (possibly concurrent) traversal
+    return set;
+}
+
+static std::vector<TopoDS_Face> shape_faces(const TopoDS_Shape& shape) {
+    std::vector<TopoDS_Face> faces;
+    for (TopExp_Explorer ex(shape, TopAbs_FACE); ex.More(); ex.Next()) faces.push_back(TopoDS::Face(ex.Current()));
+    return faces;
+}
+
+class ProximityIndex {
+public:
+    ProximityIndex(const Shape& s, double linear, double angular, bool relative, double tolerance)
+        : linear_(linear), angular_(angular), relative_(relative), tolerance_(tolerance) {
+        mesh_shape(s.shape, linear, angular, relative, false);
+        faces_ = shape_faces(s.shape);
+        set_ = triangle_set(faces_);
+    }
+
+    int face_count() const { return static_cast<int>(faces_.size()); }
+    double tolerance() const { return tolerance_; }
+
+    // Overlapping (fixed face, other face) index pairs of one candidate -> (K,2) int32.
+    nb::ndarray<nb::numpy, int> query(const Shape& other) {
+        std::vector<int> pairs;
+        {
+            nb::gil_scoped_release release;
+            mesh_shape(other.shape, linear_, angular_, relative_, false);
+            pairs = overlapping_pairs(other.shape);
+        }
+        const size_t K = pairs.size() / 2;
+        return to_numpy(std::move(pairs), {K, 2});
+    }
+
+    // Many candidates -> (pairs (K,2) int32, offsets (N+1,) int32): the pairs of candidate n are
+    // pairs[offsets[n]:offsets[n+1]]. Candidates are meshed together (each distinct face once, see
+    // mesh_shapes) and then queried in parallel on OCCT's thread pool with the GIL released.
+    nb::tuple query_many(const std::vector<Shape>& others) {
+        const int N = static_cast<int>(others.size());
+        std::vector<int> pairs;
+        std::vector<int> offsets{0};
+        {
+            nb::gil_scoped_release release;
+
+            std::vector<std::string> errors(others.size());
+            auto guarded = [&errors](int i, auto&& work) {
+                try {
+                    work();
+                } catch (const Standard_Failure& e) {
+                    errors[i] = e.GetMessageString();
+                    if (errors[i].empty()) errors[i] = "OCCT failure";
+                } catch (const std::exception& e) {
+                    errors[i] = e.what();
+                }
+            };
+            auto check = [&errors]() {
+                for (const std::string& error : errors)
+                    if (!error.empty()) throw std::runtime_error("Proximity query failed: " + error);
+            };
+
+            std::vector<TopoDS_Shape> batch;
+            batch.reserve(others.size());
+            for (const Shape& other : others) batch.push_back(other.shape);
+            if (N > 0) guarded(0, [&] { mesh_shapes(batch, linear_, angular_, relative_); });
+            check();
+
+            std::vector<std::vector<int>> results(N);
+            OSD_Parallel::For(0, N, [&](int i) { guarded(i, [&] { results[i] = overlapping_pairs(others[i].shape); }); });
+            check();
+
+            for (const auto& r : results) {
+                pairs.insert(pairs.end(), r.begin(), r.end());
+                offsets.push_back(static_cast<int>(pairs.size() / 2));
+            }
+        }
+        const size_t K = pairs.size() / 2;
+        return nb::make_tuple(to_numpy(std::move(pairs), {K, 2}), to_numpy(std::move(offsets), {static_cast<size_t>(N) + 1}));
+    }
+
+private:
+    // BRepExtrema_OverlapTool only reports which faces of each side overlap, not which with which.
+    // One traversal over the whole candidate finds its overlapping faces; each of those (few) faces
+    // is then traversed alone against the fixed BVH to pair it with the fixed faces it touches.
+    std::vector<int> overlapping_pairs(const TopoDS_Shape& other) const {
+        const std::vector<TopoDS_Face> faces = shape_faces(other);
+        std::vector<int> pairs;
+        if (faces.empty() || faces_.empty()) return pairs;
+
+        BRepExtrema_OverlapTool tool(set_, triangle_set(faces));
+        tool.Perform(tolerance_);
+        if (!tool.IsDone()) throw std::runtime_error("Overlap test could not be completed.");
+
+        std::vector<int> hits;
+        for (ProxMap::Iterator it(tool.OverlapSubShapes2()); it.More(); it.Next()) hits.push_back(it.Key());
+        std::sort(hits.begin(), hits.end());
+
+        for (int j : hits) {
+            BRepExtrema_OverlapTool single(set_, triangle_set({faces[j]}));
+            single.Perform(tolerance_);
+            std::vector<int> fixed;
+            for (ProxMap::Iterator it(single.OverlapSubShapes1()); it.More(); it.Next()) fixed.push_back(it.Key());
+            std::sort(fixed.begin(), fixed.end());
+            for (int i : fixed) {
+                pairs.push_back(i);
+                pairs.push_back(j);
+            }
+        }
+        return pairs;
+    }
+
+    double linear_, angular_;
+    bool relative_;
+    double tolerance_;
+    std::vector<TopoDS_Face> faces_;
+    opencascade::handle<BRepExtrema_TriangleSet> set_;
+};
+
+// ---------------------------------------------------------------------------
+// async jobs (progress / cancel / timeout)
+// ---------------------------------------------------------------------------
+//
+// One boolean / fillet / offset started on its own std::thread and driven through a
+// Message_ProgressRange. The indicator below records the position the algorithm reports and
+// answers UserBreak() from a cancel flag and a wall-clock deadline, so a runaway boolean or
+// fillet stops at its next progress check instead of hanging the worker process. Jobs never
+// touch Python objects (inputs are copied into the job, booleans run non-destructively).
+// Limitation: an algorithm only notices cancel/timeout where it polls its progress range;
+// BRepOffsetAPI_MakeThickSolid::MakeThickSolidBySimple takes no range, so an offset job reports
+// 0 -> 1, can only be cancelled before it starts and takes no timeout. Every job checks UserBreak()
+// once before it starts, so an already expired deadline (timeout <= 0) always ends it as "timed out".
+
+namespace {
+
+class JobProgress : public Message_ProgressIndicator {
+public:
+    std::atomic<double> position{0.0};
+    std::atomic<bool> cancelled{false};
+    std::atomic<bool> timed_out{false};
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+
+    bool UserBreak() override {
+        if (cancelled) return true;
+        if (deadline && std::chrono::steady_clock::now() >= *deadline) {
+            timed_out = true;
+            return true;
+        }
+        return false;
+    }
+
+protected:
+    void Show(const Message_ProgressScope&, const Standard_Boolean) override { position = GetPosition(); }
+};
+
+class AsyncJob {
+public:
+    // `work` computes the result shape from the progress range; it runs on the job thread.
+    AsyncJob(std::function<TopoDS_Shape(const Message_ProgressRange&)> work, std::optional<double> timeout)
+        : progress_(new JobProgress()) {
+        if (timeout) {
+            progress_->deadline = std::chrono::steady_clock::now() +
+                                  std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(*timeout));
+        }
+        thread_ = std::thread([this, work = std::move(work)]() {
+            TopoDS_Shape shape;
+            std::string error;
+            try {
+                if (progress_->UserBreak()) throw std::runtime_error("not started");
+                shape = work(progress_->Start());
+            } catch (const Standard_Failure& e) {
+                error = e.GetMessageString();
+            } catch (const std::exception& e) {
+                error = e.what();
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (progress_->timed_out) status_ = "timed out";
+            else if (progress_->cancelled) status_ = "cancelled";
+            else if (!error.empty() || shape.IsNull()) status_ = "failed";
+            else status_ = "done";
+            shape_ = shape;
+            error_ = error.empty() && status_ == "failed" ? "the operation produced no shape" : error;
+            progress_->position = 1.0;
+            finished_.notify_all();
+        });
+    }
+
+    AsyncJob(const AsyncJob&) = delete;
+    AsyncJob& operator=(const AsyncJob&) = delete;
+
+    // Cancel and wait: dropping the last Python reference never leaves a thread behind. The job
+    // may only stop at its next progress check, so other Python threads keep running meanwhile.
+    ~AsyncJob() {
+        progress_->cancelled = true;
+        if (!thread_.joinable()) return;
+        if (PyGILState_Check()) {
+            nb::gil_scoped_release release;
+            thread_.join();
+        } else {
+            thread_.join();
+        }
+    }
+
+    double progress() const { return progress_->position; }
+    void cancel() { progress_->cancelled = true; }
+
+    std::string status() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return status_;
+    }
+
+    bool done() { return status() != "running"; }
+
+    // Block until finished or `timeout` seconds passed; true if finished.
+    bool wait(std::optional<double> timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto finished = [this] { return status_ != "running"; };
+        if (!timeout) {
+            finished_.wait(lock, finished);
+            return true;
+        }
+        return finished_.wait_for(lock, std::chrono::duration<double>(*timeout), finished);
+    }
+
+    // Block until finished; the result shape, or std::runtime_error if the job failed, was
+    // cancelled or timed out.
+    Shape result() {
+        wait(std::nullopt);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (status_ == "done") return Shape(shape_);
+        if (status_ == "failed") throw std::runtime_error("Async operation failed: " + error_);
+        throw std::runtime_error("Async operation " + status_ + ".");
+    }
+
+private:
+    opencascade::handle<JobProgress> progress_;
+    std::mutex mutex_;
+    std::condition_variable finished_;
+    std::string status_ = "running";
+    TopoDS_Shape shape_;
+    std::string error_;
+    std::thread thread_;  // last member: started once everything above is initialised
+};
+
+}  // namespace
+
+template <typename Op>
+static std::unique_ptr<AsyncJob> boolean_async(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy,
+                                               std::optional<bool> parallel, std::optional<BooleanOptions> options,
+                                               std::optional<double> timeout, const char* what) {
+    BooleanOptions opts = options.value_or(BooleanOptions{});
+    opts.non_destructive = true;
+    const bool run = run_parallel(parallel);
+    return std::make_unique<AsyncJob>(
+        [A, B, fuzzy, run, opts, what](const Message_ProgressRange& range) {
+            return build_boolean<Op>(A, B, fuzzy, run, opts, what, range);
+        },
+        timeout);
+}
+
+static std::unique_ptr<AsyncJob> boolean_union_async(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy,
+                                                     std::optional<bool> parallel, std::optional<BooleanOptions> options,
+                                                     std::optional<double> timeout) {
+    return boolean_async<BRepAlgoAPI_Fuse>(A, B, fuzzy, parallel, options, timeout, "fuse");
+}
+
+static std::unique_ptr<AsyncJob> boolean_difference_async(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy,
+                                                          std::optional<bool> parallel, std::optional<BooleanOptions> options,
+                                                          std::optional<double> timeout) {
+    return boolean_async<BRepAlgoAPI_Cut>(A, B, fuzzy, parallel, options, timeout, "difference");
+}
+
+static std::unique_ptr<AsyncJob> boolean_intersection_async(const std::vector<Shape>& A, const std::vector<Shape>& B, double fuzzy,
+                                                            std::optional<bool> parallel, std::optional<BooleanOptions> options,
+                                                            std::optional<double> timeout) {
+    return boolean_async<BRepAlgoAPI_Common>(A, B, fuzzy, parallel, options, timeout, "intersection");
+}
+
+// BRepFilletAPI_MakeFillet and MakeThickSolidBySimple build new topology and leave `s` untouched.
+static std::unique_ptr<AsyncJob> fillet_async(const Shape& s, double radius, const std::vector<Shape>& exclude,
+                                              std::optional<double> timeout) {
+    const TopoDS_Shape shape = s.shape;
+    return std::make_unique<AsyncJob>(
+        [shape, radius, exclude](const Message_ProgressRange& range) { return build_fillet(shape, radius, exclude, range); }, timeout);
+}
+
+static std::unique_ptr<AsyncJob> offset_async(const Shape& s, double distance) {
+    const TopoDS_Shape shape = s.shape;
+    return std::make_unique<AsyncJob>(
+        [shape, distance](const Message_ProgressRange&) {
+            BRepOffsetAPI_MakeThickSolid builder;
+            builder.MakeThickSolidBySimple(shape, distance);
+            if (!builder.IsDone()) throw std::runtime_error("Offset operation could not be completed.");
+            return builder.Shape();
+        },
+        std::nullopt);
+}
+
 void register_boolean(nb::module_& m) {
     // These OCCT operations are long-running and operate purely on C++ data (no Python
     // callbacks), so release the GIL for the duration -> callers can run many of them in
     // parallel threads. No effect on single-threaded use.
     using gil = nb::call_guard<nb::gil_scoped_release>;
-    m.def("boolean_union", &boolean_union, gil());
-    m.def("boolean_difference", &boolean_difference, gil());
-    m.def("boolean_intersection", &boolean_intersection, gil());
+    nb::class_<BooleanOptions>(m, "BooleanOptions",
+                               "Performance options of the boolean / split algorithms, accepted as `options` by every "
+                               "boolean and split. Defaults are OCCT's.\n\n"
+                               "use_obb: prefilter candidate pairs with oriented bounding boxes.\n"
+                               "glue: 'off', 'shift' or 'full'; skips intersecting faces of inputs that only touch or "
+                               "share faces.\n"
+                               "non_destructive: never modify the inputs (sub-shapes are copied where tolerances grow).\n"
+                               "fill_history: record modified / generated / deleted sub-shapes; switch off when only "
+                               "the result is needed.")
+        .def("__init__",
+             [](BooleanOptions* self, bool use_obb, const std::string& glue, bool non_destructive, bool fill_history) {
+                 new (self) BooleanOptions{use_obb, glue_from_string(glue), non_destructive, fill_history};
+             },
+             "use_obb"_a = false, "glue"_a = "off", "non_destructive"_a = false, "fill_history"_a = true)
+        .def_rw("use_obb", &BooleanOptions::use_obb)
+        .def_prop_rw("glue",
+                     [](const BooleanOptions& o) { return glue_to_string(o.glue); },
+                     [](BooleanOptions& o, const std::string& glue) { o.glue = glue_from_string(glue); })
+        .def_rw("non_destructive", &BooleanOptions::non_destructive)
+        .def_rw("fill_history", &BooleanOptions::fill_history);
+    m.def("boolean_union", &boolean_union, "A"_a, "B"_a, "fuzzy"_a, "parallel"_a = nb::none(), "options"_a = nb::none(), gil());
+    m.def("boolean_difference", &boolean_difference, "A"_a, "B"_a, "fuzzy"_a, "parallel"_a = nb::none(), "options"_a = nb::none(), gil());
+    m.def("boolean_intersection", &boolean_intersection, "A"_a, "B"_a, "fuzzy"_a, "parallel"_a = nb::none(), "options"_a = nb::none(), gil());
+    // boolean_with_history builds numpy arrays, so it releases the GIL itself (no call_guard).
+    m.def("boolean_with_history", &boolean_with_history,
+          "operation"_a, "A"_a, "B"_a, "fuzzy"_a, "parallel"_a = nb::none(), "options"_a = nb::none());
+    m.def("boolean_batch", &boolean_batch, "jobs"_a, "options"_a = nb::none(), gil());
+    m.def("boolean_operations", &boolean_operations,
+          "A"_a, "B"_a, "operations"_a, "fuzzy"_a, "parallel"_a = nb::none(), "options"_a = nb::none(), gil());
+    m.def("set_boolean_parallel", &set_boolean_parallel, "parallel"_a);
+    m.def("boolean_parallel", &boolean_parallel);
+    m.def("set_thread_pool_size", &set_thread_pool_size, "n"_a, gil());
+    m.def("thread_pool_size", &thread_pool_size);
     m.def("section", &section, gil());
-    m.def("split", &split, gil());
+    // contours builds numpy arrays, so it releases the GIL itself (no call_guard).
+    m.def("contours", &contours, "shape"_a, "origins"_a, "normals"_a, "linear"_a, "angular"_a);
+    m.def("split", &split, "arguments"_a, "tools"_a, "fuzzy"_a = 0.0, "parallel"_a = nb::none(), "options"_a = nb::none(), gil());
+    m.def("split_grouped", &split_grouped,
+          "arguments"_a, "tools"_a, "fuzzy"_a = 0.0, "parallel"_a = nb::none(), "options"_a = nb::none(), gil());
     m.def("fillet", &fillet, gil());
+    m.def("fillet_indexed", &fillet_indexed, "shape"_a, "edges"_a, "radii"_a, "end_radii"_a = nb::none(), gil());
     m.def("offset", &offset, gil());
     m.def("overlap", &overlap, gil());
+    nb::class_<ProximityIndex>(m, "ProximityIndex", "A meshed shape with a prebuilt BVH for repeated overlap queries.")
+        .def(nb::init<const Shape&, double, double, bool, double>(),
+             "shape"_a, "linear"_a, "angular"_a, "relative"_a = false, "tolerance"_a = 0.0, gil())
+        .def_prop_ro("face_count", &ProximityIndex::face_count)
+        .def_prop_ro("tolerance", &ProximityIndex::tolerance)
+        // query / query_many build numpy arrays, so they release the GIL themselves.
+        .def("query", &ProximityIndex::query, "other"_a)
+        .def("query_many", &ProximityIndex::query_many, "others"_a);
+
+    nb::class_<AsyncJob>(m, "AsyncJob", "A boolean / fillet / offset running on a background thread.")
+        .def("progress", &AsyncJob::progress)
+        .def("cancel", &AsyncJob::cancel)
+        .def("done", &AsyncJob::done)
+        .def("status", &AsyncJob::status)
+        .def("wait", &AsyncJob::wait, "timeout"_a = nb::none(), gil())
+        .def("result", &AsyncJob::result, gil());
+    m.def("boolean_union_async", &boolean_union_async,
+          "A"_a, "B"_a, "fuzzy"_a, "parallel"_a = nb::none(), "options"_a = nb::none(), "timeout"_a = nb::none());
+    m.def("boolean_difference_async", &boolean_difference_async,
+          "A"_a, "B"_a, "fuzzy"_a, "parallel"_a = nb::none(), "options"_a = nb::none(), "timeout"_a = nb::none());
+    m.def("boolean_intersection_async", &boolean_intersection_async,
+          "A"_a, "B"_a, "fuzzy"_a, "parallel"_a = nb::none(), "options"_a = nb::none(), "timeout"_a = nb::none());
+    m.def("fillet_async", &fillet_async, "shape"_a, "radius"_a, "exclude"_a, "timeout"_a = nb::none());
+    m.def("offset_async", &offset_async, "shape"_a, "distance"_a);
 }
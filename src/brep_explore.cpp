@@ -15,6 +15,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopAbs_ShapeEnum.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepTools.hxx>
 #include <BRepTools_WireExplorer.hxx>
@@ -32,6 +33,28 @@ static std::vector<Shape> shape_explore(const Shape& s, int topabs) {
     return out;
 }
 
+// The distinct sub-shapes of `topabs` type in TopExp::MapShapes order (each shared edge/vertex once,
+// unlike shape_explore). Position k is the index that the *_indexed functions take.
+static std::vector<Shape> shape_map(const Shape& s, int topabs) {
+    TopTools_IndexedMapOfShape map;
+    TopExp::MapShapes(s.shape, static_cast<TopAbs_ShapeEnum>(topabs), map);
+    std::vector<Shape> out;
+    out.reserve(map.Extent());
+    for (int i = 1; i <= map.Extent(); ++i) out.push_back(Shape(map(i)));
+    return out;
+}
+
+// Index of each of `subshapes` in shape_map(s, topabs) (-1 if it is not a sub-shape of s); one hashed
+// lookup each instead of comparing against every sub-shape.
+static std::vector<int> shape_map_indices(const Shape& s, int topabs, const std::vector<Shape>& subshapes) {
+    TopTools_IndexedMapOfShape map;
+    TopExp::MapShapes(s.shape, static_cast<TopAbs_ShapeEnum>(topabs), map);
+    std::vector<int> out;
+    out.reserve(subshapes.size());
+    for (const Shape& sub : subshapes) out.push_back(map.FindIndex(sub.shape) - 1);
+    return out;
+}
+
 static int shape_type(const Shape& s) { return static_cast<int>(s.shape.ShapeType()); }
 static int shape_orientation(const Shape& s) { return static_cast<int>(s.shape.Orientation()); }
 static bool shape_is_same(const Shape& a, const Shape& b) { return a.shape.IsSame(b.shape); }
@@ -82,6 +105,8 @@ static Shape outer_wire(const Shape& face) {
 
 void register_explore(nb::module_& m) {
     m.def("shape_explore", &shape_explore);
+    m.def("shape_map", &shape_map, "shape"_a, "topabs"_a);
+    m.def("shape_map_indices", &shape_map_indices, "shape"_a, "topabs"_a, "subshapes"_a);
     m.def("shape_type", &shape_type);
     m.def("shape_orientation", &shape_orientation);
     m.def("shape_is_same", &shape_is_same);
@@ -1,6 +1,9 @@
 import pathlib
 from typing import Optional
 from typing import Union
+from uuid import UUID
+
+import numpy as np
 
 import compas.datastructures
 import compas.geometry
@@ -20,14 +23,13 @@ from compas_occt import _occt as _brep
 from compas_occt import _occt as _io
 from compas_occt import _occt as _meshing
 from compas_occt.conversions import aabb_to_compas
+from compas_occt.conversions import compas_mesh_to_occ_shell
 from compas_occt.conversions import compas_transformation_to_trsf
 from compas_occt.conversions import frame_to_occ_ax2
 from compas_occt.conversions import location_to_compas
-from compas_occt.conversions import ngon_to_face
+from compas_occt.conversions import ngons_to_faces
 from compas_occt.conversions import obb_to_compas
 from compas_occt.conversions import point_to_compas
-from compas_occt.conversions import quad_to_face
-from compas_occt.conversions import triangle_to_face
 from compas_occt.conversions import vector_to_occ
 from compas_occt.geometry import OCCCurve
 from compas_occt.geometry import OCCNurbsSurface
@@ -119,6 +121,19 @@ class OCCBrep(Brep):
         self._volume = None
         self._centroid = None
 
+    def __getstate__(self) -> dict:
+        # The native shape pickles as compact binary BREP without triangulations (see ``_occt.Shape.__getstate__``),
+        # which is much faster than going through ``__data__``; caches and meshes are rebuilt on demand.
+        # The guid travels along so a brep sent to a worker and back keeps its identity.
+        return {"native_brep": self.native_brep, "name": self.name, "guid": str(self.guid)}
+
+    def __setstate__(self, state: dict) -> None:
+        self.__init__()
+        self.native_brep = state["native_brep"]
+        self.name = state["name"]
+        if "guid" in state:
+            self._guid = UUID(state["guid"])
+
     def copy(self) -> "OCCBrep":
         """Deep-copy this BRep using the native OCC copying mechanism.
 
@@ -419,6 +434,53 @@ class OCCBrep(Brep):
                 strings[key] = str(value)
         _io.write_step_with_attributes(self.occ_shape, str(filepath), name or self.name or "", strings, integers, reals)
 
+    @classmethod
+    def from_files(
+        cls,
+        filenames: list[Union[str, pathlib.Path]],
+        format: str = "auto",
+        heal: bool = False,
+        solid: bool = False,
+    ) -> list["OCCBrep"]:
+        """
+        Construct BReps from many STEP and/or IGES files, read in parallel.
+
+        Parameters
+        ----------
+        filenames
+            The files.
+        format
+            ``"step"``, ``"iges"`` or ``"auto"`` (by file extension).
+        heal
+            If True, heal the shapes.
+        solid
+            If True, convert shells to solids when possible.
+
+        Returns
+        -------
+        list[OCCBrep]
+            One BRep per file, in order.
+
+        Raises
+        ------
+        RuntimeError
+            If any of the files could not be read (after all files were attempted).
+
+        """
+        results = _io.read_many([str(filename) for filename in filenames], format)
+        errors = [error for _, error in results if error]
+        if errors:
+            raise RuntimeError("Failed to read {} file(s): {}".format(len(errors), "; ".join(errors)))
+        breps = []
+        for shape, _ in results:
+            brep = cls.from_native(shape)
+            if heal:
+                brep.heal()
+            if solid:
+                brep.make_solid()
+            breps.append(brep)
+        return breps
+
     @classmethod
     def from_iges(cls, filename: Union[str, pathlib.Path], solid: bool = True) -> "OCCBrep":
         """
@@ -443,9 +505,32 @@ class OCCBrep(Brep):
             brep.make_solid()
         return brep
 
+    @classmethod
+    def from_brep(cls, filename: Union[str, pathlib.Path], binary: bool = False) -> "OCCBrep":
+        """
+        Construct a BRep from the data contained in a BREP file.
+
+        Parameters
+        ----------
+        filename
+            The file.
+        binary
+            If True, the file is in OCCT's binary BREP format (see :meth:`to_brep`).
+
+        Returns
+        -------
+        OCCBrep
+
+        """
+        if binary:
+            return cls.from_native(_io.read_brep_binary(str(filename)))
+        return cls.from_native(_io.read_brep(str(filename)))
+
     def to_brep(
         self,
         filepath: Union[str, pathlib.Path],
+        binary: bool = False,
+        triangulation: bool = False,
     ) -> None:
         """
         Write the BRep shape to a BREP file.
@@ -454,13 +539,20 @@ class OCCBrep(Brep):
         ----------
         filepath
             Location of the file.
+        binary
+            If True, use OCCT's binary BREP format, which is smaller and much faster to write and read.
+        triangulation
+            If True (binary only), also store the current triangulation of the faces.
 
         Returns
         -------
         None
 
         """
-        _io.write_brep(self.native_brep, str(filepath))
+        if binary:
+            _io.write_brep_binary(self.native_brep, str(filepath), triangulation)
+        else:
+            _io.write_brep(self.native_brep, str(filepath))
 
     def to_step(
         self,
@@ -501,10 +593,69 @@ class OCCBrep(Brep):
         filepath: Union[str, pathlib.Path],
         linear_deflection: float = 1e-3,
         angular_deflection: float = 0.5,
+        ascii: bool = True,
     ) -> bool:
         """
         Write the BRep shape to a STL file.
 
+        Parameters
+        ----------
+        filepath
+            Location of the file.
+        linear_deflection
+            Allowable deviation between curved geometry and mesh discretisation.
+        angular_deflection
+            Maximum angle between two adjacent facets.
+        ascii
+            Write ASCII STL if True, binary STL otherwise (as ``to_bytes("stl", ascii=...)``).
+
+        Returns
+        -------
+        None
+
+        """
+        return _io.write_stl(self.occ_shape, str(filepath), linear_deflection, angular_deflection, ascii)
+
+    def to_ply(
+        self,
+        filepath: Union[str, pathlib.Path],
+        linear_deflection: float = 1e-3,
+        angular_deflection: float = 0.5,
+    ) -> None:
+        """
+        Write a tesselation of the BRep shape to a binary PLY file.
+
+        The triangles are streamed to disk face by face, without building the mesh in memory.
+        The vertices of adjacent faces are not merged.
+
+        Parameters
+        ----------
+        filepath
+            Location of the file.
+        linear_deflection
+            Allowable deviation between curved geometry and mesh discretisation.
+        angular_deflection
+            Maximum angle between two adjacent facets.
+
+        Returns
+        -------
+        None
+
+        """
+        _io.write_ply(self.occ_shape, str(filepath), linear_deflection, angular_deflection)
+
+    def to_glb(
+        self,
+        filepath: Union[str, pathlib.Path],
+        linear_deflection: float = 1e-3,
+        angular_deflection: float = 0.5,
+    ) -> None:
+        """
+        Write a tesselation of the BRep shape to a binary glTF (.glb) file.
+
+        The triangles are streamed to disk face by face, without building the mesh in memory.
+        The vertices of adjacent faces are not merged.
+
         Parameters
         ----------
         filepath
@@ -519,7 +670,7 @@ class OCCBrep(Brep):
         None
 
         """
-        return _io.write_stl(self.occ_shape, str(filepath), linear_deflection, angular_deflection)
+        _io.write_glb(self.occ_shape, str(filepath), linear_deflection, angular_deflection)
 
     def to_iges(self, filepath: Union[str, pathlib.Path]) -> bool:
         """
@@ -537,6 +688,82 @@ class OCCBrep(Brep):
         """
         return _io.write_iges(self.occ_shape, str(filepath))
 
+    @classmethod
+    def from_bytes(cls, data: Union[bytes, bytearray, memoryview], format: str = "step") -> "OCCBrep":
+        """
+        Construct a BRep from in-memory file data.
+
+        STEP and BREP data are parsed in place, without going through the filesystem.
+        IGES data is not: OCCT's IGES reader only reads files, so the data is written to
+        a temporary file, read from there and the file is removed again.
+        STL import is not supported.
+
+        Parameters
+        ----------
+        data
+            The content of a STEP, IGES or BREP file. STEP and BREP buffers are read in place (no copy).
+        format
+            ``"step"``, ``"iges"``, ``"brep"`` or ``"brep_binary"``.
+
+        Returns
+        -------
+        OCCBrep
+
+        """
+        readers = {
+            "step": _io.read_step_bytes,
+            "iges": _io.read_iges_bytes,
+            "brep": _io.read_brep_bytes,
+            "brep_binary": _io.read_brep_binary_bytes,
+        }
+        if format not in readers:
+            raise ValueError("Unsupported format: {} (expected one of {}).".format(format, ", ".join(readers)))
+        return cls.from_native(readers[format](np.frombuffer(data, dtype=np.uint8)))
+
+    def to_bytes(
+        self,
+        format: str = "step",
+        unit: str = "MM",
+        linear_deflection: float = 1e-3,
+        angular_deflection: float = 0.5,
+        triangulation: bool = False,
+        ascii: bool = True,
+    ) -> bytes:
+        """
+        Serialize the BRep shape to in-memory file data, without going through the filesystem.
+
+        Parameters
+        ----------
+        format
+            ``"step"``, ``"iges"``, ``"brep"``, ``"brep_binary"`` or ``"stl"``.
+        unit
+            Base units for the geometry (STEP only).
+        linear_deflection
+            Maximum linear deflection of the triangulation (STL only).
+        angular_deflection
+            Maximum angular deflection of the triangulation (STL only).
+        triangulation
+            If True, also store the current triangulation of the faces (binary BREP only).
+        ascii
+            ASCII STL if True, binary STL otherwise, as in :meth:`to_stl` (STL only).
+
+        Returns
+        -------
+        bytes
+
+        """
+        if format == "step":
+            return _io.write_step_bytes(self.occ_shape, unit, self.name or "")
+        if format == "iges":
+            return _io.write_iges_bytes(self.occ_shape)
+        if format == "brep":
+            return _io.write_brep_bytes(self.native_brep)
+        if format == "brep_binary":
+            return _io.write_brep_binary_bytes(self.native_brep, triangulation)
+        if format == "stl":
+            return _io.write_stl_bytes(self.occ_shape, linear_deflection, angular_deflection, ascii)
+        raise ValueError("Unsupported format: {} (expected step, iges, brep, brep_binary or stl).".format(format))
+
     # ==============================================================================
     # Constructors
     # ==============================================================================
@@ -718,7 +945,7 @@ class OCCBrep(Brep):
         return Brep.from_native(shape)
 
     @classmethod
-    def from_mesh(cls, mesh: compas.datastructures.Mesh, solid: bool = True) -> "OCCBrep":
+    def from_mesh(cls, mesh: compas.datastructures.Mesh, solid: bool = True, tolerance: float = 1e-6) -> "OCCBrep":
         """
         Construct a BRep from a COMPAS mesh.
 
@@ -728,22 +955,15 @@ class OCCBrep(Brep):
             The input mesh.
         solid
             Flag indicating that if the resulting shape should be converted to a solid, if possible.
+        tolerance
+            Mesh faces within this distance of their best-fit plane become planar faces.
 
         Returns
         -------
         OCCBrep
 
         """
-        faces = []
-        for face in mesh.faces():
-            points = mesh.face_polygon(face)
-            if len(points) == 3:
-                faces.append(triangle_to_face(points))
-            elif len(points) == 4:
-                faces.append(quad_to_face(points))
-            else:
-                faces.append(ngon_to_face(points))
-        shell = _brep.shell_from_faces(faces)
+        shell = compas_mesh_to_occ_shell(mesh, tolerance)
         brep = cls.from_native(shell)
         brep.heal()
         if solid:
@@ -784,14 +1004,8 @@ class OCCBrep(Brep):
         OCCBrep
 
         """
-        faces = []
-        for points in polygons:
-            if len(points) == 3:
-                faces.append(triangle_to_face(points))
-            elif len(points) == 4:
-                faces.append(quad_to_face(points))
-            else:
-                faces.append(ngon_to_face(points))
+        # planar polygons get a plane, non-planar quads a ruled surface, other ngons a filling; all in one batch
+        faces = ngons_to_faces(polygons)
         shell = _brep.shell_from_faces(faces)
         brep = cls.from_native(shell)
         brep.heal()
@@ -983,6 +1197,8 @@ class OCCBrep(Brep):
         A: Union["OCCBrep", list["OCCBrep"]],
         B: Union["OCCBrep", list["OCCBrep"]],
         tol=None,
+        parallel: Optional[bool] = None,
+        options=None,
     ) -> "OCCBrep":
         """
         Construct a BRep from the boolean difference of two other BReps.
@@ -993,6 +1209,10 @@ class OCCBrep(Brep):
             A OCCBrep or list of OCCBreps to subtract from.
         B
             A OCCBrep or list of OCCBreps to subtract.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``.
 
         Returns
         -------
@@ -1000,7 +1220,7 @@ class OCCBrep(Brep):
 
         """
         tol = tol or TOL.absolute
-        shape = _brep.boolean_difference(_shape_list(A), _shape_list(B), tol)
+        shape = _brep.boolean_difference(_shape_list(A), _shape_list(B), tol, parallel, options)
         brep = cls.from_native(shape)
         brep.sew()
         brep.fix()
@@ -1013,6 +1233,8 @@ class OCCBrep(Brep):
         A: Union["OCCBrep", list["OCCBrep"]],
         B: Union["OCCBrep", list["OCCBrep"]],
         tol=None,
+        parallel: Optional[bool] = None,
+        options=None,
     ) -> "OCCBrep":
         """
         Construct a BRep from the boolean intersection of two other BReps.
@@ -1023,6 +1245,10 @@ class OCCBrep(Brep):
             A OCCBrep or list of OCCBreps.
         B
             A OCCBrep or list of OCCBreps.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``.
 
         Returns
         -------
@@ -1035,7 +1261,7 @@ class OCCBrep(Brep):
         """
         tol = tol or TOL.absolute
         try:
-            shape = _brep.boolean_intersection(_shape_list(A), _shape_list(B), tol)
+            shape = _brep.boolean_intersection(_shape_list(A), _shape_list(B), tol, parallel, options)
         except RuntimeError as e:
             raise BrepBooleanError(str(e))
         brep = cls.from_native(shape)
@@ -1049,6 +1275,8 @@ class OCCBrep(Brep):
         A: Union["OCCBrep", list["OCCBrep"]],
         B: Union["OCCBrep", list["OCCBrep"]],
         tol=None,
+        parallel: Optional[bool] = None,
+        options=None,
     ) -> "OCCBrep":
         """
         Construct a BRep from the boolean union of two other BReps.
@@ -1059,6 +1287,10 @@ class OCCBrep(Brep):
             A OCCBrep or list of OCCBreps.
         B
             A OCCBrep or list of OCCBreps.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``.
 
         Returns
         -------
@@ -1071,7 +1303,7 @@ class OCCBrep(Brep):
         """
         tol = tol or TOL.absolute
         try:
-            shape = _brep.boolean_union(_shape_list(A), _shape_list(B), tol)
+            shape = _brep.boolean_union(_shape_list(A), _shape_list(B), tol, parallel, options)
         except RuntimeError as e:
             raise BrepBooleanError(str(e))
         brep = cls.from_native(shape)
@@ -1079,6 +1311,164 @@ class OCCBrep(Brep):
         brep.make_solid()
         return brep
 
+    @classmethod
+    def from_boolean_operations(
+        cls,
+        A: Union["OCCBrep", list["OCCBrep"]],
+        B: Union["OCCBrep", list["OCCBrep"]],
+        operations: tuple[str, ...] = ("union", "difference", "intersection"),
+        tol=None,
+        parallel: Optional[bool] = None,
+        options=None,
+    ) -> dict[str, "OCCBrep"]:
+        """
+        Construct several boolean results of the same two sets of BReps.
+
+        The intersection of the inputs is computed only once and shared by all the results,
+        which is much faster than calling the boolean constructors one by one.
+
+        Parameters
+        ----------
+        A
+            A OCCBrep or list of OCCBreps.
+        B
+            A OCCBrep or list of OCCBreps.
+        operations
+            The results to compute: any of ``"union"``, ``"difference"`` (A - B), ``"intersection"`` and ``"section"``.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``.
+
+        Returns
+        -------
+        dict[str, OCCBrep]
+            The result of every operation, keyed by operation.
+
+        Raises
+        ------
+        BrepBooleanError
+
+        """
+        tol = tol or TOL.absolute
+        operations = list(operations)
+        try:
+            shapes = _brep.boolean_operations(_shape_list(A), _shape_list(B), operations, tol, parallel, options)
+        except RuntimeError as e:
+            raise BrepBooleanError(str(e))
+        results = {}
+        for operation, shape in zip(operations, shapes):
+            brep = cls.from_native(shape)
+            if operation != "section":
+                brep.heal()
+                brep.make_solid()
+            results[operation] = brep
+        return results
+
+    @classmethod
+    def from_boolean_with_history(
+        cls,
+        A: Union["OCCBrep", list["OCCBrep"]],
+        B: Union["OCCBrep", list["OCCBrep"]],
+        operation: str = "union",
+        tol=None,
+        parallel: Optional[bool] = None,
+        options=None,
+    ) -> tuple["OCCBrep", dict]:
+        """
+        Construct a boolean of two sets of BReps together with the history of their faces.
+
+        Input faces are numbered through the faces of ``A`` and then of ``B`` (each in :attr:`faces` order);
+        output face indices refer to the :attr:`faces` of the returned BRep, which is therefore not healed.
+
+        Parameters
+        ----------
+        A
+            A OCCBrep or list of OCCBreps.
+        B
+            A OCCBrep or list of OCCBreps.
+        operation
+            ``"union"``, ``"difference"`` (A - B) or ``"intersection"``.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``; history is always recorded.
+
+        Returns
+        -------
+        tuple[OCCBrep, dict]
+            The result and its history: the output faces of input face ``f`` are
+            ``faces[offsets[f]:offsets[f + 1]]`` (modified images, or the face itself if it was kept),
+            faces generated from it are ``generated[generated_offsets[f]:generated_offsets[f + 1]]``,
+            and ``deleted`` lists the input faces that do not survive.
+
+        Raises
+        ------
+        BrepBooleanError
+
+        """
+        tol = tol or TOL.absolute
+        try:
+            history = _brep.boolean_with_history(operation, _shape_list(A), _shape_list(B), tol, parallel, options)
+        except RuntimeError as e:
+            raise BrepBooleanError(str(e))
+        brep = cls.from_native(history.pop("shape"))
+        return brep, history
+
+    @classmethod
+    def from_split(
+        cls,
+        arguments: Union["OCCBrep", list["OCCBrep"]],
+        tools: Union["OCCBrep", list["OCCBrep"]],
+        tol: float = 0.0,
+        parallel: Optional[bool] = None,
+        options=None,
+    ) -> list[list["OCCBrep"]]:
+        """
+        Split several BReps by several tools at once and group the pieces by the BRep they came from.
+
+        The pieces are associated with their argument through the splitter history,
+        so no geometric matching is needed afterwards.
+
+        Parameters
+        ----------
+        arguments
+            The BRep(s) to split.
+        tools
+            The splitting BRep(s), e.g. many planar faces.
+        tol
+            Fuzzy value: additional tolerance for the intersection of nearly coincident geometry.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``; history is always recorded.
+
+        Returns
+        -------
+        list[list[OCCBrep]]
+            The pieces of every argument, in argument order.
+
+        Raises
+        ------
+        BrepBooleanError
+            If the splitter fails.
+        RuntimeError
+            If the splitter history does not trace a piece back to one of the arguments.
+
+        """
+        arguments = _shape_list(arguments)
+        try:
+            pieces, sources = _brep.split_grouped(arguments, _shape_list(tools), tol, parallel, options)
+        except RuntimeError as e:
+            raise BrepBooleanError(str(e))
+        unknown = sum(1 for source in sources if source < 0)
+        if unknown:
+            raise RuntimeError("The splitter history did not trace {} piece(s) back to an argument.".format(unknown))
+        groups = [[] for _ in arguments]
+        for shape, source in zip(pieces, sources):
+            groups[source].append(cls.from_shape(shape))
+        return groups
+
     # ==============================================================================
     # Converters
     # ==============================================================================
@@ -1087,6 +1477,7 @@ class OCCBrep(Brep):
         self,
         linear_deflection: Optional[float] = None,
         angular_deflection: Optional[float] = None,
+        welded: bool = False,
     ) -> tuple[Mesh, list[Polyline]]:
         """
         Create a tesselation of the shape for visualisation.
@@ -1097,6 +1488,9 @@ class OCCBrep(Brep):
             Allowable "distance" deviation between curved geometry and mesh discretisation.
         angular_deflection
             Allowable "curvature" deviation between curved geometry and mesh discretisation.
+        welded
+            If True, the mesh vertices on the boundaries between faces are shared by the adjacent faces,
+            which makes the mesh of a closed shape watertight, and every edge polyline is returned once.
 
         Returns
         -------
@@ -1106,11 +1500,80 @@ class OCCBrep(Brep):
         linear_deflection = linear_deflection or TOL.lineardeflection
         angular_deflection = angular_deflection or TOL.angulardeflection
 
-        vertices, triangles, edges = _meshing.tesselate(self.occ_shape, linear_deflection, angular_deflection)
+        vertices, triangles, (points, offsets, _) = _meshing.tesselate(self.occ_shape, linear_deflection, angular_deflection, welded, flat_edges=True)
         mesh = Mesh.from_vertices_and_faces(vertices, triangles)
-        polylines = [Polyline([point_to_compas(point) for point in polyline]) for polyline in edges]
+        points = points.tolist()
+        offsets = offsets.tolist()
+        polylines = [Polyline(points[start:end]) for start, end in zip(offsets[:-1], offsets[1:])]
         return mesh, polylines
 
+    def to_tesselation_arrays(
+        self,
+        linear_deflection: Optional[float] = None,
+        angular_deflection: Optional[float] = None,
+        welded: bool = False,
+    ) -> dict:
+        """
+        Create a rendering-ready tesselation of the shape as numpy arrays.
+
+        Unlike :meth:`to_tesselation`, no COMPAS mesh is built: the arrays come straight from the
+        OCCT triangulation (zero-copy) and can be uploaded to a GPU as they are.
+
+        Parameters
+        ----------
+        linear_deflection
+            Allowable "distance" deviation between curved geometry and mesh discretisation.
+        angular_deflection
+            Allowable "curvature" deviation between curved geometry and mesh discretisation.
+        welded
+            If True, the vertices on the boundaries between faces are shared by the adjacent faces.
+            Their normals are then averaged over those faces and their ``uvs`` are those of the first face.
+
+        Returns
+        -------
+        dict
+            ``vertices`` (V, 3), ``triangles`` (T, 3), ``normals`` (V, 3) unit outward vertex normals,
+            ``uvs`` (V, 2) surface parameters, ``face_ids`` (T,) the index in :attr:`faces`
+            of the face each triangle belongs to, and the edge polylines in CSR form:
+            polyline ``i`` is ``edge_points[edge_offsets[i]:edge_offsets[i + 1]]`` and
+            ``edge_ids[i]`` identifies the edge it discretises (index among the distinct edges of the shape,
+            so the two sides of a seam between faces share one id).
+
+        """
+        linear_deflection = linear_deflection or TOL.lineardeflection
+        angular_deflection = angular_deflection or TOL.angulardeflection
+
+        return _meshing.tesselate_arrays(self.occ_shape, linear_deflection, angular_deflection, welded)
+
+    def to_tesselation_lods(
+        self,
+        levels: list[tuple[float, float]],
+        welded: bool = False,
+    ) -> list[dict]:
+        """
+        Create a level-of-detail pyramid of rendering-ready tesselations in one pass.
+
+        The levels are meshed one after the other on a copy of the shape, coarsest first,
+        and each finer level only re-meshes the faces and edges that the previous level
+        does not already discretise finely enough. The triangulation of this brep itself
+        is left untouched.
+
+        Parameters
+        ----------
+        levels
+            The ``(linear_deflection, angular_deflection)`` of every level, in any order.
+        welded
+            If True, the vertices on the boundaries between faces are shared by the adjacent faces.
+
+        Returns
+        -------
+        list[dict]
+            One dict per level, ordered from coarse to fine, with the arrays of :meth:`to_tesselation_arrays`
+            and the ``linear`` and ``angular`` deflection of the level.
+
+        """
+        return _meshing.tesselate_lods(self.occ_shape, [(float(linear), float(angular)) for linear, angular in levels], welded)
+
     def to_meshes(self, u: int = 16, v: int = 16) -> list[Mesh]:
         """
         Convert the faces of the BRep shape to meshes.
@@ -1273,13 +1736,17 @@ class OCCBrep(Brep):
     # Other Methods
     # ==============================================================================
 
-    def boolean_difference(self, *others: "OCCBrep", tol=None) -> "OCCBrep":
+    def boolean_difference(self, *others: "OCCBrep", tol=None, parallel: Optional[bool] = None, options=None) -> "OCCBrep":
         """Return the boolean difference of this shape and a collection of other shapes.
 
         Parameters
         ----------
         others
             A collection of other BRep shapes to subtract from the current shape.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``.
 
         Results
         -------
@@ -1293,7 +1760,7 @@ class OCCBrep(Brep):
         """
         tol = tol or TOL.absolute
         try:
-            shape = _brep.boolean_difference([self.native_brep], [b.native_brep for b in others], tol)
+            shape = _brep.boolean_difference([self.native_brep], [b.native_brep for b in others], tol, parallel, options)
         except RuntimeError as e:
             raise BrepBooleanError(str(e))
         cls = type(self)
@@ -1302,13 +1769,17 @@ class OCCBrep(Brep):
         brep.make_solid()
         return brep
 
-    def boolean_intersection(self, *others: "OCCBrep", tol=None) -> "OCCBrep":
+    def boolean_intersection(self, *others: "OCCBrep", tol=None, parallel: Optional[bool] = None, options=None) -> "OCCBrep":
         """Return the boolean intersection of the current shape and a collection of other shapes.
 
         Parameters
         ----------
         others
             A collection of other BRep shapes to intersect with the current shape.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``.
 
         Returns
         -------
@@ -1322,7 +1793,7 @@ class OCCBrep(Brep):
         """
         tol = tol or TOL.absolute
         try:
-            shape = _brep.boolean_intersection([self.native_brep], [b.native_brep for b in others], tol)
+            shape = _brep.boolean_intersection([self.native_brep], [b.native_brep for b in others], tol, parallel, options)
         except RuntimeError as e:
             raise BrepBooleanError(str(e))
         cls = type(self)
@@ -1331,13 +1802,17 @@ class OCCBrep(Brep):
         brep.make_solid()
         return brep
 
-    def boolean_union(self, *others: "OCCBrep", tol=None) -> "OCCBrep":
+    def boolean_union(self, *others: "OCCBrep", tol=None, parallel: Optional[bool] = None, options=None) -> "OCCBrep":
         """Return the boolean union of the current shape and a collection of other shapes.
 
         Parameters
         ----------
         others
             A collection of other BRep shapes to unite with the current shape.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``.
 
         Returns
         -------
@@ -1351,7 +1826,7 @@ class OCCBrep(Brep):
         """
         tol = tol or TOL.absolute
         try:
-            shape = _brep.boolean_union([self.native_brep], [b.native_brep for b in others], tol)
+            shape = _brep.boolean_union([self.native_brep], [b.native_brep for b in others], tol, parallel, options)
         except RuntimeError as e:
             raise BrepBooleanError(str(e))
         cls = type(self)
@@ -1372,14 +1847,25 @@ class OCCBrep(Brep):
         if self.type == SHELL:
             print(_brep.is_valid(self.occ_shape))
 
-    def contours(self, planes: list[compas.geometry.Plane]) -> list[list[compas.geometry.Polyline]]:
+    def contours(
+        self,
+        planes: list[compas.geometry.Plane],
+        linear_deflection: Optional[float] = None,
+        angular_deflection: Optional[float] = None,
+    ) -> list[list[compas.geometry.Polyline]]:
         """
         Generate contour lines by slicing the BRep shape with a series of planes.
 
+        All planes are processed in one parallel call (see :meth:`contour_arrays`).
+
         Parameters
         ----------
         planes
-            The slicing planes.
+            The slicing planes (or frames).
+        linear_deflection
+            Allowable "distance" deviation between curved contours and their polylines.
+        angular_deflection
+            Allowable "curvature" deviation between curved contours and their polylines.
 
         Returns
         -------
@@ -1387,7 +1873,60 @@ class OCCBrep(Brep):
             A list of polylines per plane.
 
         """
-        raise NotImplementedError
+        planes = [Plane.from_frame(plane) if isinstance(plane, Frame) else plane for plane in planes]
+        origins = [list(plane.point) for plane in planes]
+        normals = [list(plane.normal) for plane in planes]
+        points, offsets, plane_ids = self.contour_arrays(origins, normals, linear_deflection, angular_deflection)
+        points = points.tolist()
+        contours = [[] for _ in planes]
+        for start, end, index in zip(offsets[:-1].tolist(), offsets[1:].tolist(), plane_ids.tolist()):
+            contours[index].append(Polyline(points[start:end]))
+        return contours
+
+    def contour_arrays(
+        self,
+        origins,
+        normals,
+        linear_deflection: Optional[float] = None,
+        angular_deflection: Optional[float] = None,
+    ) -> tuple:
+        """
+        Slice the BRep shape with many planes at once and return the contours as flat arrays.
+
+        The face bounding boxes are computed once and put into a BVH shared by all planes,
+        so every plane only sections the faces it can cut, and the planes are sectioned in parallel.
+        For layers along one direction, pass ``origins = base + offsets[:, None] * normal`` and a single repeated normal.
+
+        Parameters
+        ----------
+        origins
+            The plane origins, array-like of shape (P, 3).
+        normals
+            The plane normals, array-like of shape (P, 3).
+        linear_deflection
+            Allowable "distance" deviation between curved contours and their polylines.
+        angular_deflection
+            Allowable "curvature" deviation between curved contours and their polylines.
+
+        Returns
+        -------
+        tuple
+            ``(points, offsets, plane_ids)``: polyline ``i`` is ``points[offsets[i]:offsets[i + 1]]``
+            and lies in plane ``plane_ids[i]``. Closed contours repeat their first point.
+
+        Raises
+        ------
+        RuntimeError
+            If the section with one of the planes fails.
+
+        """
+        linear_deflection = linear_deflection or TOL.lineardeflection
+        angular_deflection = angular_deflection or TOL.angulardeflection
+        origins = np.ascontiguousarray(origins, dtype=np.float64).reshape(-1, 3)
+        normals = np.ascontiguousarray(normals, dtype=np.float64).reshape(-1, 3)
+        if len(normals) == 1 and len(origins) > 1:
+            normals = np.ascontiguousarray(np.repeat(normals, len(origins), axis=0))
+        return _brep.contours(self.occ_shape, origins, normals, linear_deflection, angular_deflection)
 
     def cull_unused_vertices(self) -> None:
         """
@@ -1464,6 +2003,45 @@ class OCCBrep(Brep):
         except RuntimeError as e:
             raise BrepFilletError(str(e))
 
+    def fillet_edges(
+        self,
+        edges: list[OCCBrepEdge],
+        radii: Union[float, list[float]],
+        end_radii: Union[float, list[float], None] = None,
+    ) -> None:
+        """Fillet selected edges of a BRep, each with its own (or a variable) radius.
+
+        Parameters
+        ----------
+        edges
+            The edges to fillet.
+        radii
+            One radius for all edges, or one radius per edge.
+        end_radii
+            Optional radius at the end of each edge (one for all, or one per edge).
+            The radius then varies linearly from ``radii`` to ``end_radii`` along the edge.
+
+        Raises
+        ------
+        BrepFilletError
+            If the fillet operation could not be completed.
+
+        Returns
+        -------
+        None
+            the Brep is modified in-place.
+
+        """
+        indices = np.array(_brep.shape_map_indices(self.occ_shape, 6, [edge.occ_edge for edge in edges]), dtype=np.int32)
+        if (indices < 0).any():
+            raise ValueError("All edges must belong to this Brep.")
+        radii = np.atleast_1d(np.asarray(radii, dtype=np.float64))
+        end_radii = None if end_radii is None else np.atleast_1d(np.asarray(end_radii, dtype=np.float64))
+        try:
+            self.occ_shape = _brep.fillet_indexed(self.occ_shape, indices, radii, end_radii)
+        except RuntimeError as e:
+            raise BrepFilletError(str(e))
+
     def filleted(self, radius: float, exclude: Optional[list[OCCBrepEdge]] = None) -> "OCCBrep":
         """Construct a copy of a Brep with filleted edges.
 
@@ -1638,6 +2216,43 @@ class OCCBrep(Brep):
         brep = OCCBrep.from_native(shape)
         return brep if brep.faces else None
 
+    def proximity_index(
+        self,
+        linear_deflection: Optional[float] = None,
+        angular_deflection: Optional[float] = None,
+        tolerance: float = 0.0,
+        relative: bool = False,
+    ):
+        """Mesh this BRep once and keep its BVH for repeated :meth:`overlap` queries.
+
+        Use this when one fixed shape is tested against many others: ``index.query(other.native_brep)``
+        returns the overlapping ``(face of this brep, face of other)`` index pairs as an int32 array of shape
+        ``(K, 2)``, and ``index.query_many([...])`` answers a whole batch in parallel as ``(pairs, offsets)``, with
+        the pairs of candidate ``n`` in ``pairs[offsets[n]:offsets[n + 1]]``. Face indices refer to :attr:`faces`.
+
+        Parameters
+        ----------
+        linear_deflection
+            Maximum linear deflection for shape approximation (this brep and every candidate).
+        angular_deflection
+            Maximum angular deflection for shape approximation.
+        tolerance
+            Allowable deviation between shapes.
+
+        Other Parameters
+        ----------------
+        relative
+            If True, linear deflection used for faces is the maximum linear deflection of their edges.
+
+        Returns
+        -------
+        :class:`compas_occt._occt.ProximityIndex`
+
+        """
+        linear_deflection = linear_deflection or TOL.lineardeflection
+        angular_deflection = angular_deflection or TOL.angulardeflection
+        return _brep.ProximityIndex(self.native_brep, linear_deflection, angular_deflection, relative, tolerance)
+
     def sew(self):
         """
         Sew together the individual parts of the shape.
@@ -1707,20 +2322,33 @@ class OCCBrep(Brep):
             return None
         return OCCBrep.from_native(occ_shape)
 
-    def split(self, other: "OCCBrep") -> list["OCCBrep"]:
+    def split(self, other: "OCCBrep", tol: float = 0.0, parallel: Optional[bool] = None, options=None) -> list["OCCBrep"]:
         """Split a BRep using another BRep as splitter.
 
         Parameters
         ----------
         other
             Another brep.
+        tol
+            Fuzzy value: additional tolerance for the intersection of nearly coincident geometry.
+        parallel
+            Use OCCT's thread pool. Defaults to ``_occt.boolean_parallel()``.
+        options
+            Optional ``_occt.BooleanOptions``.
 
         Returns
         -------
         list[OCCBrep]
 
+        Raises
+        ------
+        BrepBooleanError
+
         """
-        results = _brep.split([self.occ_shape], [other.occ_shape])
+        try:
+            results = _brep.split([self.occ_shape], [other.occ_shape], tol, parallel, options)
+        except RuntimeError as e:
+            raise BrepBooleanError(str(e))
         return [OCCBrep.from_shape(shape) for shape in results]
 
     def transform(self, matrix: compas.geometry.Transformation) -> None:
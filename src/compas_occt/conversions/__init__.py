@@ -67,10 +67,12 @@ from .geometry import obb_to_compas
 
 from .transformations import compas_transformation_to_trsf
 
+from .meshes import arrays_to_occ_shell
 from .meshes import compas_mesh_to_occ_shell
 from .meshes import compas_quadmesh_to_occ_shell
 from .meshes import compas_trimesh_to_occ_shell
 from .meshes import ngon_to_face
+from .meshes import ngons_to_faces
 from .meshes import quad_to_face
 from .meshes import triangle_to_face
 
@@ -135,12 +137,14 @@ __all__ = [
     "vector_to_occ",
     "vector_to_occ2d",
     "compas_transformation_to_trsf",
+    "arrays_to_occ_shell",
     "compas_mesh_to_occ_shell",
     "compas_quadmesh_to_occ_shell",
     "compas_trimesh_to_occ_shell",
     "floats2_from_array2",
     "harray1_from_points1",
     "ngon_to_face",
+    "ngons_to_faces",
     "points1_from_array1",
     "points2_from_array2",
     "quad_to_face",
@@ -8,6 +8,8 @@ return :class:`Shape` handle wrappers (faces/shells), matching ``compas_occ``'s
 from typing import Annotated
 from typing import Union
 
+import numpy as np
+
 import compas.geometry
 from compas.datastructures import Mesh
 from compas.geometry import Polygon
@@ -53,14 +55,81 @@ def quad_to_face(quad: Quad):
     return _meshing.quad_to_face(_coords(quad))
 
 
-def ngon_to_face(ngon: NGon):
-    """Convert an ngon to a BRep face with a best-fit surface (``Shape``)."""
+def ngon_to_face(ngon: NGon, tolerance: float = 1e-6):
+    """Convert an ngon to a BRep face (``Shape``).
+
+    If all points lie within ``tolerance`` of their best-fit plane, the face is planar.
+    Otherwise a quad gets the ruled surface of :func:`quad_to_face` and larger ngons
+    a best-fit (N-sided filling) surface.
+
+    """
+    from compas_occt import _occt as _meshing
+
+    return _meshing.ngon_to_face(_coords(ngon), tolerance)
+
+
+def ngons_to_faces(ngons: list[NGon], tolerance: float = 1e-6) -> list:
+    """Convert many ngons to BRep faces (``Shape``) in one parallel call.
+
+    Equivalent to calling :func:`ngon_to_face` on every ngon.
+
+    Raises
+    ------
+    ValueError
+        If an ngon has less than three points.
+
+    """
+    from compas_occt import _occt as _meshing
+
+    return _meshing.ngons_to_faces([_coords(ngon) for ngon in ngons], tolerance)
+
+
+def arrays_to_occ_shell(vertices, faces, offsets=None, tolerance: float = 1e-6):
+    """Convert a face-vertex mesh given as arrays to an OCC shell (``Shape``) in one call.
+
+    Adjacent faces share their BRep vertices and edges, so the shell is already sewn.
+    Faces within ``tolerance`` of their best-fit plane get that plane, as in :func:`ngon_to_face`;
+    non-planar quads get a ruled surface and other non-planar faces a filling surface.
+
+    Parameters
+    ----------
+    vertices
+        The vertex coordinates, shape (V, 3).
+    faces
+        Either a (F, 3) or (F, 4) array of triangles/quads, or, with ``offsets``, the vertex indices
+        of all faces back to back.
+    offsets
+        Optional (F + 1,) array: face ``i`` is ``faces[offsets[i]:offsets[i + 1]]``.
+    tolerance
+        Maximum distance of the corners of a face to its plane for the face to be planar.
+
+    Raises
+    ------
+    ValueError
+        If an index or the offsets are out of range.
+
+    """
     from compas_occt import _occt as _meshing
 
-    return _meshing.ngon_to_face(_coords(ngon))
+    vertices = np.ascontiguousarray(vertices, dtype=np.float64).reshape(-1, 3)
+    faces = np.asarray(faces, dtype=np.int32)
+    if offsets is None:
+        if faces.ndim != 2:
+            raise ValueError("Without offsets, faces should be a (F, 3) or (F, 4) array.")
+        offsets = np.arange(0, faces.size + 1, max(faces.shape[1], 1), dtype=np.int32)
+    indices = np.ascontiguousarray(faces.ravel(), dtype=np.int32)
+    offsets = np.ascontiguousarray(offsets, dtype=np.int32)
+    return _meshing.mesh_to_shell(vertices, indices, offsets, tolerance)
+
 
+def _mesh_to_occ_shell(mesh: Mesh, tolerance: float = 1e-6):
+    vertices, faces = mesh.to_vertices_and_faces()
+    offsets = np.cumsum([0] + [len(face) for face in faces])
+    indices = [index for face in faces for index in face]
+    return arrays_to_occ_shell(vertices, indices, offsets, tolerance)
 
-def compas_trimesh_to_occ_shell(mesh: Mesh):
+
+def compas_trimesh_to_occ_shell(mesh: Mesh, tolerance: float = 1e-6):
     """Convert a COMPAS triangle mesh to an OCC shell (``Shape``).
 
     Raises
@@ -71,13 +140,10 @@ def compas_trimesh_to_occ_shell(mesh: Mesh):
     """
     if not mesh.is_trimesh():
         raise ValueError("The input mesh is not a triangle mesh.")
-    from compas_occt import _occt as _meshing
+    return _mesh_to_occ_shell(mesh, tolerance)
 
-    faces = [_meshing.triangle_to_face(_coords(mesh.face_coordinates(face))) for face in mesh.faces()]
-    return _meshing.shell_from_faces(faces)
 
-
-def compas_quadmesh_to_occ_shell(mesh: Mesh):
+def compas_quadmesh_to_occ_shell(mesh: Mesh, tolerance: float = 1e-6):
     """Convert a COMPAS quad mesh to an OCC shell (``Shape``).
 
     Raises
@@ -88,23 +154,13 @@ def compas_quadmesh_to_occ_shell(mesh: Mesh):
     """
     if not mesh.is_quadmesh():
         raise ValueError("The input mesh is not a quad mesh.")
-    from compas_occt import _occt as _meshing
+    return _mesh_to_occ_shell(mesh, tolerance)
 
-    faces = [_meshing.quad_to_face(_coords(mesh.face_coordinates(face))) for face in mesh.faces()]
-    return _meshing.shell_from_faces(faces)
 
+def compas_mesh_to_occ_shell(mesh: Mesh, tolerance: float = 1e-6):
+    """Convert a general COMPAS mesh to an OCC shell (``Shape``).
 
-def compas_mesh_to_occ_shell(mesh: Mesh):
-    """Convert a general COMPAS mesh to an OCC shell (``Shape``)."""
-    from compas_occt import _occt as _meshing
+    Faces within ``tolerance`` of their best-fit plane are planar (see :func:`arrays_to_occ_shell`).
 
-    faces = []
-    for face in mesh.faces():
-        points = _coords(mesh.face_coordinates(face))
-        if len(points) == 3:
-            faces.append(_meshing.triangle_to_face(points))
-        elif len(points) == 4:
-            faces.append(_meshing.quad_to_face(points))
-        else:
-            faces.append(_meshing.ngon_to_face(points))
-    return _meshing.shell_from_faces(faces)
+    """
+    return _mesh_to_occ_shell(mesh, tolerance)
@@ -1,18 +1,43 @@
-// io.cpp - the `_io` extension module: STEP / IGES / STL / BREP read & write.
+// io.cpp - the `_io` extension module: STEP / IGES / STL / PLY / GLB / BREP (text and binary) read & write.
 #include "compas.h"
 #include "occt.h"
+#include "meshing.h"
+#include "streams.h"
 
 #include <nanobind/stl/map.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <locale>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 
+#include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <gp_Trsf.hxx>
 #include <BRepTools.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
+#include <BinTools.hxx>
+#include <BinTools_FormatVersion.hxx>
 #include <STEPControl_Reader.hxx>
 #include <STEPControl_Writer.hxx>
 #include <STEPControl_StepModelType.hxx>
@@ -23,9 +48,12 @@
 #include <IGESControl_Writer.hxx>
 #include <IGESControl_Controller.hxx>
 #include <StlAPI_Writer.hxx>
-#include <Interface_Static.hxx>
+#include <DESTEP_Parameters.hxx>
+#include <UnitsMethods_LengthUnit.hxx>
 #include <IFSelect_ReturnStatus.hxx>
 #include <OSD.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_Process.hxx>
 #include <Standard_Failure.hxx>
 // XDE / XCAF: STEP with names + named-data attributes (cf. OCCT PR #634)
 #include <TDocStd_Document.hxx>
@@ -41,12 +69,32 @@
 #include <TDF_LabelSequence.hxx>
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_ExtendedString.hxx>
+// ---------------------------------------------------------------------------
+// controller initialisation
+// ---------------------------------------------------------------------------
+//
+// The controllers register the STEP/IGES norms, protocols and Interface_Static parameters in
+// process-global tables (the static-lib initializers are not auto-pulled). Init() is not safe to
+// race with itself or with a reader already using those tables, so it runs exactly once; after
+// that every reader/writer owns its own work session and model, and concurrent calls only read
+// the shared tables.
+
+static void init_step() {
+    static std::once_flag once;
+    std::call_once(once, [] { STEPControl_Controller::Init(); });
+}
+
+static void init_iges() {
+    static std::once_flag once;
+    std::call_once(once, [] { IGESControl_Controller::Init(); });
+}
+
 // ---------------------------------------------------------------------------
 // STEP
 // ---------------------------------------------------------------------------
 
 static Shape read_step(const std::string& filepath) {
-    STEPControl_Controller::Init();  // register the STEP norm/schema (static-lib initializer is not auto-pulled)
+    init_step();
     STEPControl_Reader reader;
     IFSelect_ReturnStatus status = reader.ReadFile(filepath.c_str());
     if (status != IFSelect_RetDone) throw std::runtime_error("Failed to read STEP file.");
@@ -54,20 +102,65 @@ static Shape read_step(const std::string& filepath) {
     return Shape(reader.OneShape());
 }
 
+// Per-writer STEP settings. They go into the writer's own model (STEPControl_Writer::Transfer with
+// DESTEP_Parameters) instead of the process-global Interface_Static, so concurrent writes with
+// different units / schemas / product names cannot see each other's settings. Everything not set
+// here keeps the current static defaults.
+static UnitsMethods_LengthUnit step_unit(const std::string& unit) {
+    static const std::map<std::string, UnitsMethods_LengthUnit> units = {
+        {"MM", UnitsMethods_LengthUnit_Millimeter}, {"CM", UnitsMethods_LengthUnit_Centimeter},
+        {"M", UnitsMethods_LengthUnit_Meter},       {"KM", UnitsMethods_LengthUnit_Kilometer},
+        {"UM", UnitsMethods_LengthUnit_Micron},     {"INCH", UnitsMethods_LengthUnit_Inch},
+        {"IN", UnitsMethods_LengthUnit_Inch},       {"FT", UnitsMethods_LengthUnit_Foot},
+        {"MI", UnitsMethods_LengthUnit_Mile},       {"MIL", UnitsMethods_LengthUnit_Mil},
+        {"UIN", UnitsMethods_LengthUnit_Microinch},
+    };
+    std::string key = unit;
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    auto it = units.find(key);
+    if (it == units.end()) throw std::invalid_argument("Unknown STEP unit '" + unit + "'.");
+    return it->second;
+}
+
+static DESTEP_Parameters::WriteMode_StepSchema step_schema(const std::string& schema) {
+    if (schema == "AP203") return DESTEP_Parameters::WriteMode_StepSchema_AP203;
+    if (schema == "AP214" || schema == "AP214CD") return DESTEP_Parameters::WriteMode_StepSchema_AP214CD;
+    if (schema == "AP214DIS") return DESTEP_Parameters::WriteMode_StepSchema_AP214DIS;
+    if (schema == "AP214IS") return DESTEP_Parameters::WriteMode_StepSchema_AP214IS;
+    if (schema == "AP242" || schema == "AP242DIS") return DESTEP_Parameters::WriteMode_StepSchema_AP242DIS;
+    throw std::invalid_argument("Unknown STEP schema '" + schema + "' (expected AP203, AP214[CD|DIS|IS] or AP242[DIS]).");
+}
+
+static DESTEP_Parameters step_parameters(const std::string& unit, const std::string& name) {
+    DESTEP_Parameters parameters;
+    parameters.InitFromStatic();
+    parameters.WriteUnit = step_unit(unit);
+    if (!name.empty()) parameters.WriteProductName = name.c_str();
+    return parameters;
+}
+
+static void transfer_step(STEPControl_Writer& writer, const TopoDS_Shape& shape, const DESTEP_Parameters& parameters) {
+    if (writer.Transfer(shape, STEPControl_AsIs, parameters) != IFSelect_RetDone)
+        throw std::runtime_error("Failed to transfer shape to STEP.");
+}
+
+static void write_step_file(const TopoDS_Shape& shape, const std::string& filepath, const DESTEP_Parameters& parameters) {
+    STEPControl_Writer writer;
+    transfer_step(writer, shape, parameters);
+    IFSelect_ReturnStatus status = writer.Write(filepath.c_str());
+    if (status != IFSelect_RetDone) throw std::runtime_error("Failed to write STEP file.");
+}
+
 static void write_step(const Shape& s, const std::string& filepath, const std::string& unit,
                        const std::string& name, const std::string& author,
                        const std::string& organization, const std::string& description) {
-    STEPControl_Controller::Init();  // register the STEP norm/schema
+    init_step();
     (void)author;
     (void)organization;
     (void)description;  // FILE_NAME metadata not written (see write_step note below)
+    const DESTEP_Parameters parameters = step_parameters(unit, name);
     try {
-        STEPControl_Writer writer;
-        Interface_Static::SetCVal("write.step.unit", unit.c_str());
-        if (!name.empty()) Interface_Static::SetCVal("write.step.product.name", name.c_str());
-        writer.Transfer(s.shape, STEPControl_AsIs);
-        IFSelect_ReturnStatus status = writer.Write(filepath.c_str());
-        if (status != IFSelect_RetDone) throw std::runtime_error("Failed to write STEP file.");
+        write_step_file(s.shape, filepath, parameters);
     } catch (const Standard_Failure& e) {
         throw std::runtime_error(std::string("STEP write failed: ") + e.GetMessageString());
     }
@@ -91,7 +184,7 @@ static void write_step_with_attributes(const Shape& s, const std::string& filepa
                                        const std::map<std::string, std::string>& strings,
                                        const std::map<std::string, int>& integers,
                                        const std::map<std::string, double>& reals) {
-    STEPControl_Controller::Init();
+    init_step();
     opencascade::handle<TDocStd_Document> doc;
     XCAFApp_Application::GetApplication()->NewDocument("MDTV-XCAF", doc);
     opencascade::handle<XCAFDoc_ShapeTool> tool = XCAFDoc_DocumentTool::ShapeTool(doc->Main());
@@ -125,7 +218,7 @@ using StepRecord = std::tuple<Shape, std::string,
                               std::map<std::string, double>>;
 
 static std::vector<StepRecord> read_step_with_attributes(const std::string& filepath) {
-    STEPControl_Controller::Init();
+    init_step();
     opencascade::handle<TDocStd_Document> doc;
     XCAFApp_Application::GetApplication()->NewDocument("MDTV-XCAF", doc);
 
@@ -177,12 +270,11 @@ static std::vector<StepRecord> read_step_with_attributes(const std::string& file
 
 // Schema-controlled single-shape STEP export (used by OCCCurve.to_step / OCCSurface.to_step).
 static void shape_to_step(const Shape& s, const std::string& filepath, const std::string& schema) {
-    STEPControl_Controller::Init();
-    STEPControl_Writer writer;
-    Interface_Static::SetCVal("write.step.schema", schema.c_str());
-    writer.Transfer(s.shape, STEPControl_AsIs);
-    IFSelect_ReturnStatus status = writer.Write(filepath.c_str());
-    if (status != IFSelect_RetDone) throw std::runtime_error("Failed to write STEP file.");
+    init_step();
+    DESTEP_Parameters parameters;
+    parameters.InitFromStatic();
+    parameters.WriteSchema = step_schema(schema);
+    write_step_file(s.shape, filepath, parameters);
 }
 
 // ---------------------------------------------------------------------------
@@ -190,7 +282,7 @@ static void shape_to_step(const Shape& s, const std::string& filepath, const std
 // ---------------------------------------------------------------------------
 
 static Shape read_iges(const std::string& filepath) {
-    IGESControl_Controller::Init();
+    init_iges();
     IGESControl_Reader reader;
     IFSelect_ReturnStatus status = reader.ReadFile(filepath.c_str());
     if (status != IFSelect_RetDone) throw std::runtime_error("Failed to read IGES file.");
@@ -198,8 +290,61 @@ static Shape read_iges(const std::string& filepath) {
     return Shape(reader.OneShape());
 }
 
+// ---------------------------------------------------------------------------
+// batch read
+// ---------------------------------------------------------------------------
+
+// (shape or None, error message or "")
+using ReadResult = std::pair<std::optional<Shape>, std::string>;
+
+static std::string lower_extension(const std::string& filepath) {
+    const size_t dot = filepath.find_last_of('.');
+    std::string ext = dot == std::string::npos ? std::string() : filepath.substr(dot + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext;
+}
+
+// Read many STEP / IGES files at once -> one (shape, error) per file, in order. `format` is "step",
+// "iges" or "auto" (by extension: .step/.stp, .iges/.igs). Both controllers are initialised once up
+// front, then the files are read on OCCT's thread pool with the GIL released, each with its own
+// reader (work session, model and transfer state). A file that fails to read does not abort the
+// batch: its shape is None and its error carries the message.
+static std::vector<ReadResult> read_many(const std::vector<std::string>& filepaths, const std::string& format) {
+    enum class Kind { Step, Iges };
+    std::vector<Kind> kinds;
+    kinds.reserve(filepaths.size());
+    for (const auto& filepath : filepaths) {
+        const std::string f = format == "auto" ? lower_extension(filepath) : format;
+        if (f == "step" || f == "stp") kinds.push_back(Kind::Step);
+        else if (f == "iges" || f == "igs") kinds.push_back(Kind::Iges);
+        else throw std::invalid_argument("read_many: cannot read '" + filepath + "' (format must be step, iges or auto).");
+    }
+    init_step();
+    init_iges();
+
+    std::vector<TopoDS_Shape> shapes(filepaths.size());
+    std::vector<std::string> errors(filepaths.size());
+    OSD_Parallel::For(0, static_cast<int>(filepaths.size()), [&](int i) {
+        try {
+            shapes[i] = kinds[i] == Kind::Step ? read_step(filepaths[i]).shape : read_iges(filepaths[i]).shape;
+        } catch (const Standard_Failure& e) {
+            errors[i] = filepaths[i] + ": " + e.GetMessageString();
+        } catch (const std::exception& e) {
+            errors[i] = filepaths[i] + ": " + e.what();
+        }
+    });
+
+    std::vector<ReadResult> out;
+    out.reserve(filepaths.size());
+    for (size_t i = 0; i < filepaths.size(); ++i) {
+        if (errors[i].empty()) out.emplace_back(Shape(shapes[i]), std::string());
+        else out.emplace_back(std::nullopt, errors[i]);
+    }
+    return out;
+}
+
 static bool write_iges(const Shape& s, const std::string& filepath) {
-    IGESControl_Controller::Init();
+    init_iges();
     IGESControl_Writer writer;
     if (!writer.AddShape(s.shape)) throw std::runtime_error("Failed to add shape to IGES writer.");
     writer.ComputeModel();
@@ -210,14 +355,184 @@ static bool write_iges(const Shape& s, const std::string& filepath) {
 // STL
 // ---------------------------------------------------------------------------
 
-static bool write_stl(const Shape& s, const std::string& filepath, double linear_deflection, double angular_deflection) {
-    BRepMesh_IncrementalMesh mesher(s.shape, linear_deflection, Standard_False, angular_deflection, Standard_True);
-    mesher.Perform();
+static bool write_stl(const Shape& s, const std::string& filepath, double linear_deflection, double angular_deflection, bool ascii) {
+    mesh_shape(s.shape, linear_deflection, angular_deflection, false, true);
     StlAPI_Writer writer;
-    writer.ASCIIMode() = Standard_True;
+    writer.ASCIIMode() = ascii;
     return writer.Write(s.shape, filepath.c_str());
 }
 
+// ---------------------------------------------------------------------------
+// PLY / GLB (binary, streamed)
+// ---------------------------------------------------------------------------
+//
+// The triangulation is written face by face straight from the Poly_Triangulation of each face,
+// so no whole-model vertex/index buffer is ever built: peak memory is one face's chunk. Both
+// formats need the totals up front (PLY header, glTF accessors), so a first cheap pass over the
+// faces counts nodes/triangles (and the bounds glTF requires). Vertices are not welded across
+// faces; triangles of REVERSED faces are flipped so the winding is consistently outward.
+
+namespace {
+
+// Visit (triangulation, transformation, reversed) of every meshed face, in TopExp order.
+template <typename Fn>
+void for_each_triangulation(const TopoDS_Shape& shape, Fn&& fn) {
+    for (TopExp_Explorer ex(shape, TopAbs_FACE); ex.More(); ex.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(ex.Current());
+        TopLoc_Location loc;
+        opencascade::handle<Poly_Triangulation> tri = BRep_Tool::Triangulation(face, loc);
+        if (tri.IsNull() || tri->NbTriangles() == 0) continue;
+        fn(*tri, loc.Transformation(), face.Orientation() == TopAbs_REVERSED);
+    }
+}
+
+// Little-endian chunk writer: values are appended to a small buffer that is flushed per face.
+struct LEBuffer {
+    std::vector<char> bytes;
+
+    template <typename T>
+    void put(T value) {
+        char raw[sizeof(T)];
+        std::memcpy(raw, &value, sizeof(T));
+        if constexpr (std::endian::native == std::endian::big) std::reverse(raw, raw + sizeof(T));
+        bytes.insert(bytes.end(), raw, raw + sizeof(T));
+    }
+    void flush(std::ostream& out) {
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        bytes.clear();
+    }
+};
+
+struct MeshTotals {
+    uint64_t nodes = 0;
+    uint64_t triangles = 0;
+    double min[3] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+    double max[3] = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+};
+
+// First pass: counts (and, when `bounds`, the float32 bounding box of the nodes).
+MeshTotals mesh_totals(const TopoDS_Shape& shape, bool bounds) {
+    MeshTotals totals;
+    for_each_triangulation(shape, [&](const Poly_Triangulation& tri, const gp_Trsf& trsf, bool) {
+        totals.nodes += tri.NbNodes();
+        totals.triangles += tri.NbTriangles();
+        if (!bounds) return;
+        for (int i = 1; i <= tri.NbNodes(); ++i) {
+            const gp_Pnt p = tri.Node(i).Transformed(trsf);
+            const double xyz[3] = {p.X(), p.Y(), p.Z()};
+            for (int k = 0; k < 3; ++k) {
+                const double v = static_cast<float>(xyz[k]);  // bounds of the values actually written
+                totals.min[k] = std::min(totals.min[k], v);
+                totals.max[k] = std::max(totals.max[k], v);
+            }
+        }
+    });
+    return totals;
+}
+
+void put_nodes(LEBuffer& buffer, const Poly_Triangulation& tri, const gp_Trsf& trsf) {
+    for (int i = 1; i <= tri.NbNodes(); ++i) {
+        const gp_Pnt p = tri.Node(i).Transformed(trsf);
+        buffer.put(static_cast<float>(p.X()));
+        buffer.put(static_cast<float>(p.Y()));
+        buffer.put(static_cast<float>(p.Z()));
+    }
+}
+
+// Triangle (i) of `tri` as global 0-based indices, winding flipped for reversed faces.
+std::array<uint32_t, 3> triangle_indices(const Poly_Triangulation& tri, int i, bool reversed, uint64_t base) {
+    Standard_Integer n1, n2, n3;
+    tri.Triangle(i).Get(n1, n2, n3);
+    if (reversed) std::swap(n2, n3);
+    return {static_cast<uint32_t>(base + n1 - 1), static_cast<uint32_t>(base + n2 - 1), static_cast<uint32_t>(base + n3 - 1)};
+}
+
+}  // namespace
+
+// Binary little-endian PLY: float x/y/z vertices, uchar-counted int vertex_indices faces.
+static void write_ply(const Shape& s, const std::string& filepath, double linear_deflection, double angular_deflection) {
+    mesh_shape(s.shape, linear_deflection, angular_deflection, false, true);
+    const MeshTotals totals = mesh_totals(s.shape, false);
+    if (totals.nodes > std::numeric_limits<int32_t>::max()) throw std::runtime_error("PLY export: too many vertices.");
+
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out) throw std::runtime_error("Failed to write PLY file.");
+    out << "ply\nformat binary_little_endian 1.0\ncomment compas_occt\n"
+        << "element vertex " << totals.nodes << "\nproperty float x\nproperty float y\nproperty float z\n"
+        << "element face " << totals.triangles << "\nproperty list uchar int vertex_indices\nend_header\n";
+
+    LEBuffer buffer;
+    for_each_triangulation(s.shape, [&](const Poly_Triangulation& tri, const gp_Trsf& trsf, bool) {
+        put_nodes(buffer, tri, trsf);
+        buffer.flush(out);
+    });
+    uint64_t base = 0;
+    for_each_triangulation(s.shape, [&](const Poly_Triangulation& tri, const gp_Trsf&, bool reversed) {
+        for (int i = 1; i <= tri.NbTriangles(); ++i) {
+            buffer.put(static_cast<uint8_t>(3));
+            for (uint32_t index : triangle_indices(tri, i, reversed, base)) buffer.put(static_cast<int32_t>(index));
+        }
+        buffer.flush(out);
+        base += tri.NbNodes();
+    });
+    if (!out) throw std::runtime_error("Failed to write PLY file.");
+}
+
+// Binary glTF 2.0 (.glb): one mesh with one triangle primitive (POSITION float32 VEC3, uint32
+// indices) in a single buffer laid out as [positions | indices].
+static void write_glb(const Shape& s, const std::string& filepath, double linear_deflection, double angular_deflection) {
+    mesh_shape(s.shape, linear_deflection, angular_deflection, false, true);
+    const MeshTotals totals = mesh_totals(s.shape, true);
+    if (totals.nodes == 0) throw std::runtime_error("GLB export: the shape has no triangulated faces.");
+    if (totals.nodes > std::numeric_limits<uint32_t>::max()) throw std::runtime_error("GLB export: too many vertices.");
+
+    const uint64_t positions_size = totals.nodes * 12;
+    const uint64_t indices_size = totals.triangles * 12;
+    const uint64_t bin_size = positions_size + indices_size;  // multiple of 4 already
+    if (bin_size > std::numeric_limits<uint32_t>::max() - 1024) throw std::runtime_error("GLB export: the model exceeds 4 GB.");
+
+    std::ostringstream json;
+    json.imbue(std::locale::classic());
+    json.precision(9);
+    json << R"({"asset":{"version":"2.0","generator":"compas_occt"},"scene":0,"scenes":[{"nodes":[0]}],"nodes":[{"mesh":0}],)"
+         << R"("meshes":[{"primitives":[{"attributes":{"POSITION":0},"indices":1,"mode":4}]}],)"
+         << R"("buffers":[{"byteLength":)" << bin_size << "}],"
+         << R"("bufferViews":[{"buffer":0,"byteOffset":0,"byteLength":)" << positions_size << R"(,"target":34962},)"
+         << R"({"buffer":0,"byteOffset":)" << positions_size << R"(,"byteLength":)" << indices_size << R"(,"target":34963}],)"
+         << R"("accessors":[{"bufferView":0,"componentType":5126,"count":)" << totals.nodes << R"(,"type":"VEC3","min":[)"
+         << totals.min[0] << "," << totals.min[1] << "," << totals.min[2] << R"(],"max":[)"
+         << totals.max[0] << "," << totals.max[1] << "," << totals.max[2] << "]},"
+         << R"({"bufferView":1,"componentType":5125,"count":)" << totals.triangles * 3 << R"(,"type":"SCALAR"}]})";
+    std::string header = json.str();
+    header.resize((header.size() + 3) / 4 * 4, ' ');  // JSON chunk is space-padded to 4 bytes
+
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out) throw std::runtime_error("Failed to write GLB file.");
+    LEBuffer buffer;
+    buffer.put(uint32_t{0x46546C67});  // "glTF"
+    buffer.put(uint32_t{2});
+    buffer.put(static_cast<uint32_t>(12 + 8 + header.size() + 8 + bin_size));
+    buffer.put(static_cast<uint32_t>(header.size()));
+    buffer.put(uint32_t{0x4E4F534A});  // "JSON"
+    buffer.bytes.insert(buffer.bytes.end(), header.begin(), header.end());
+    buffer.put(static_cast<uint32_t>(bin_size));
+    buffer.put(uint32_t{0x004E4942});  // "BIN\0"
+    buffer.flush(out);
+
+    for_each_triangulation(s.shape, [&](const Poly_Triangulation& tri, const gp_Trsf& trsf, bool) {
+        put_nodes(buffer, tri, trsf);
+        buffer.flush(out);
+    });
+    uint64_t base = 0;
+    for_each_triangulation(s.shape, [&](const Poly_Triangulation& tri, const gp_Trsf&, bool reversed) {
+        for (int i = 1; i <= tri.NbTriangles(); ++i)
+            for (uint32_t index : triangle_indices(tri, i, reversed, base)) buffer.put(index);
+        buffer.flush(out);
+        base += tri.NbNodes();
+    });
+    if (!out) throw std::runtime_error("Failed to write GLB file.");
+}
+
 // ---------------------------------------------------------------------------
 // BREP
 // ---------------------------------------------------------------------------
@@ -233,6 +548,168 @@ static Shape read_brep(const std::string& filepath) {
     return Shape(shape);
 }
 
+// Binary BREP (BinTools): the same topology/geometry as the text format, several times smaller and
+// faster to write and parse (no number formatting). `triangulation` also stores the faces'
+// Poly_Triangulation (with normals, when present), so a meshed shape needs no re-meshing after reading.
+static void write_brep_binary(const Shape& s, const std::string& filepath, bool triangulation) {
+    if (!BinTools::Write(s.shape, filepath.c_str(), triangulation, triangulation, BinTools_FormatVersion_CURRENT))
+        throw std::runtime_error("Failed to write binary BREP file.");
+}
+
+static Shape read_brep_binary(const std::string& filepath) {
+    TopoDS_Shape shape;
+    if (!BinTools::Read(shape, filepath.c_str())) throw std::runtime_error("Failed to read binary BREP file.");
+    return Shape(shape);
+}
+
+// ---------------------------------------------------------------------------
+// in-memory (bytes)
+// ---------------------------------------------------------------------------
+//
+// The same formats read from / written to Python bytes instead of files. Input is parsed in place:
+// any contiguous uint8 buffer (bytes, bytearray, memoryview, numpy) is wrapped in a MemoryBuffer
+// (streams.h) and handed to OCCT's stream readers, so no copy or temporary file is made. Output is
+// written to a string stream with the GIL released and copied once into the returned bytes.
+// OCCT's IGES reader only reads files, so read_iges_bytes goes through a temporary file (named from
+// the process id and random bytes, so forked workers never share one); write_stl_bytes does the same
+// with StlAPI_Writer so to_bytes("stl") and to_stl agree byte for byte. There is no STL import in this
+// module, so STL is export-only.
+
+using ByteArray = nb::ndarray<const uint8_t, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+
+static Shape read_step_bytes(const ByteArray& data) {
+    init_step();
+    MemoryBuffer buffer(data.data(), data.shape(0));
+    std::istream in(&buffer);
+    STEPControl_Reader reader;
+    if (reader.ReadStream("bytes.step", in) != IFSelect_RetDone) throw std::runtime_error("Failed to read STEP data.");
+    reader.TransferRoots();
+    return Shape(reader.OneShape());
+}
+
+// Fresh path in the temp directory: process id + 64 random bits, so neither threads nor forked
+// workers (which inherit any in-process counter or seed) can pick the same name.
+static std::filesystem::path temporary_path(const std::string& extension) {
+    static const std::string pid = std::to_string(OSD_Process().ProcessId());
+    std::random_device random;
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    for (;;) {
+        const uint64_t bits = (static_cast<uint64_t>(random()) << 32) ^ random();
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(bits));
+        std::filesystem::path path = directory / ("compas_occt_" + pid + "_" + hex + extension);
+        if (!std::filesystem::exists(path)) return path;
+    }
+}
+
+static Shape read_iges_bytes(const ByteArray& data) {
+    const std::filesystem::path path = temporary_path(".igs");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.shape(0)));
+        if (!out) throw std::runtime_error("Failed to buffer IGES data.");
+    }
+    try {
+        Shape shape = read_iges(path.string());
+        std::filesystem::remove(path);
+        return shape;
+    } catch (...) {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+        throw;
+    }
+}
+
+static Shape read_brep_bytes(const ByteArray& data) {
+    MemoryBuffer buffer(data.data(), data.shape(0));
+    std::istream in(&buffer);
+    TopoDS_Shape shape;
+    BRep_Builder builder;
+    BRepTools::Read(shape, in, builder);
+    if (shape.IsNull()) throw std::runtime_error("Failed to read BREP data.");
+    return Shape(shape);
+}
+
+static nb::bytes write_step_bytes(const Shape& s, const std::string& unit, const std::string& name) {
+    std::ostringstream out;
+    {
+        nb::gil_scoped_release release;
+        init_step();
+        STEPControl_Writer writer;
+        transfer_step(writer, s.shape, step_parameters(unit, name));
+        if (writer.WriteStream(out) != IFSelect_RetDone) throw std::runtime_error("Failed to write STEP data.");
+    }
+    const std::string bytes = out.str();
+    return nb::bytes(bytes.data(), bytes.size());
+}
+
+static nb::bytes write_iges_bytes(const Shape& s) {
+    std::ostringstream out;
+    {
+        nb::gil_scoped_release release;
+        init_iges();
+        IGESControl_Writer writer;
+        if (!writer.AddShape(s.shape)) throw std::runtime_error("Failed to add shape to IGES writer.");
+        writer.ComputeModel();
+        if (!writer.Write(out)) throw std::runtime_error("Failed to write IGES data.");
+    }
+    const std::string bytes = out.str();
+    return nb::bytes(bytes.data(), bytes.size());
+}
+
+static nb::bytes write_brep_bytes(const Shape& s) {
+    std::ostringstream out;
+    {
+        nb::gil_scoped_release release;
+        BRepTools::Write(s.shape, out);
+    }
+    const std::string bytes = out.str();
+    return nb::bytes(bytes.data(), bytes.size());
+}
+
+static Shape read_brep_binary_bytes(const ByteArray& data) {
+    MemoryBuffer buffer(data.data(), data.shape(0));
+    std::istream in(&buffer);
+    TopoDS_Shape shape;
+    if (!BinTools::Read(shape, in)) throw std::runtime_error("Failed to read binary BREP data.");
+    return Shape(shape);
+}
+
+static nb::bytes write_brep_binary_bytes(const Shape& s, bool triangulation) {
+    std::ostringstream out;
+    {
+        nb::gil_scoped_release release;
+        if (!BinTools::Write(s.shape, out, triangulation, triangulation, BinTools_FormatVersion_CURRENT))
+            throw std::runtime_error("Failed to write binary BREP data.");
+    }
+    const std::string bytes = out.str();
+    return nb::bytes(bytes.data(), bytes.size());
+}
+
+// Through a temporary file, so the bytes are exactly what write_stl writes for the same shape.
+static nb::bytes write_stl_bytes(const Shape& s, double linear_deflection, double angular_deflection, bool ascii) {
+    std::string bytes;
+    {
+        nb::gil_scoped_release release;
+        const std::filesystem::path path = temporary_path(".stl");
+        try {
+            if (!write_stl(s, path.string(), linear_deflection, angular_deflection, ascii))
+                throw std::runtime_error("Failed to write STL data.");
+            bytes.resize(std::filesystem::file_size(path));
+            std::ifstream in(path, std::ios::binary);
+            in.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            if (!in) throw std::runtime_error("Failed to read back STL data.");
+            in.close();
+            std::filesystem::remove(path);
+        } catch (...) {
+            std::error_code ignored;
+            std::filesystem::remove(path, ignored);
+            throw;
+        }
+    }
+    return nb::bytes(bytes.data(), bytes.size());
+}
+
 void register_io(nb::module_& m) {
     OSD::SetSignal(Standard_False);  // OCCT faults -> catchable exceptions (FP masked for the host process)
     // File I/O (STEP/IGES/STL/BREP) is slow and pure C++ -> release the GIL throughout so it
@@ -250,8 +727,24 @@ void register_io(nb::module_& m) {
     m.def("edge_to_step", &shape_to_step, "shape"_a, "filepath"_a, "schema"_a = "AP203", gil());
     m.def("face_to_step", &shape_to_step, "shape"_a, "filepath"_a, "schema"_a = "AP203", gil());
     m.def("read_iges", &read_iges, gil());
+    m.def("read_many", &read_many, "filepaths"_a, "format"_a = "auto", gil());
     m.def("write_iges", &write_iges, gil());
-    m.def("write_stl", &write_stl, "shape"_a, "filepath"_a, "linear_deflection"_a = 1e-3, "angular_deflection"_a = 0.5, gil());
+    m.def("write_stl", &write_stl,
+          "shape"_a, "filepath"_a, "linear_deflection"_a = 1e-3, "angular_deflection"_a = 0.5, "ascii"_a = true, gil());
+    m.def("write_ply", &write_ply, "shape"_a, "filepath"_a, "linear_deflection"_a = 1e-3, "angular_deflection"_a = 0.5, gil());
+    m.def("write_glb", &write_glb, "shape"_a, "filepath"_a, "linear_deflection"_a = 1e-3, "angular_deflection"_a = 0.5, gil());
     m.def("write_brep", &write_brep, gil());
     m.def("read_brep", &read_brep, gil());
+    m.def("write_brep_binary", &write_brep_binary, "shape"_a, "filepath"_a, "triangulation"_a = false, gil());
+    m.def("read_brep_binary", &read_brep_binary, "filepath"_a, gil());
+    m.def("read_step_bytes", &read_step_bytes, "data"_a, gil());
+    m.def("read_iges_bytes", &read_iges_bytes, "data"_a, gil());
+    m.def("read_brep_bytes", &read_brep_bytes, "data"_a, gil());
+    m.def("read_brep_binary_bytes", &read_brep_binary_bytes, "data"_a, gil());
+    // the *_bytes writers build a Python bytes object, so they release the GIL themselves.
+    m.def("write_step_bytes", &write_step_bytes, "shape"_a, "unit"_a = "MM", "name"_a = "");
+    m.def("write_iges_bytes", &write_iges_bytes, "shape"_a);
+    m.def("write_brep_bytes", &write_brep_bytes, "shape"_a);
+    m.def("write_brep_binary_bytes", &write_brep_binary_bytes, "shape"_a, "triangulation"_a = false);
+    m.def("write_stl_bytes", &write_stl_bytes, "shape"_a, "linear_deflection"_a = 1e-3, "angular_deflection"_a = 0.5, "ascii"_a = true);
 }
@@ -4,13 +4,27 @@
 // intentionally not built), plus the polygon->face builders used by conversions/meshes.py.
 #include "compas.h"
 #include "occt.h"
+#include "meshing.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Edge.hxx>
+#include <TopoDS_Vertex.hxx>
 #include <TopoDS_Shell.hxx>
+#include <TopoDS_Wire.hxx>
+#include <TopoDS_TShape.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopAbs_Orientation.hxx>
@@ -22,11 +36,20 @@
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <GCPnts_TangentialDeflection.hxx>
+#include <OSD_Parallel.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Poly_Triangle.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
+#include <BRepLib_ToolTriangulatedShape.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Pnt2d.hxx>
+#include <gp_Pln.hxx>
+#include <gp_XYZ.hxx>
+#include <gp.hxx>
 #include <TColStd_Array1OfInteger.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepFill_Filling.hxx>
 #include <GeomAbs_Shape.hxx>
@@ -35,82 +58,558 @@
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_Surface.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <ShapeBuild_ReShape.hxx>
+#include <ShapeFix_Face.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
 
-// Tessellate a shape -> (vertices (V,3) float64, triangles (T,3) int32, edge-polylines).
-// Vertices/triangles are returned as zero-copy numpy arrays. Triangle winding is flipped for
-// REVERSED faces so the mesh has consistent outward normals.
-static nb::tuple tesselate(const Shape& s, double linear, double angular) {
-    BRepMesh_IncrementalMesh mesher(s.shape, linear, Standard_False, angular, Standard_True);
-    mesher.Perform();
+// ---------------------------------------------------------------------------
+// triangulation cache
+// ---------------------------------------------------------------------------
+//
+// Keyed on the TShape address (the triangulation lives on the TShape, so the shape's Location
+// does not matter). Each entry holds the shape, so the address cannot be recycled while it is
+// cached, and the triangulation handle of every face as BRepMesh left it: a hit requires each face
+// to still carry exactly that triangulation, so a shape re-meshed elsewhere (coarser, or with a
+// different angular deflection, which Poly_Triangulation does not record) is a miss. Bounded FIFO
+// with a small default: every entry keeps its shape and the face triangulations alive after Python
+// has dropped them, so a long-running viewer holds at most `capacity` meshed shapes.
+
+namespace {
+
+struct MeshParams {
+    double linear;
+    double angular;
+    bool relative;
+};
+
+using FaceTriangulations = std::vector<opencascade::handle<Poly_Triangulation>>;
+
+struct MeshEntry {
+    TopoDS_Shape shape;  // pins the TShape the entry is keyed on
+    MeshParams params;
+    FaceTriangulations triangulations;  // TopExp_Explorer(FACE) order
+};
+
+struct MeshCache {
+    std::mutex mutex;
+    std::unordered_map<const TopoDS_TShape*, MeshEntry> entries;
+    std::deque<const TopoDS_TShape*> order;  // insertion order, for eviction
+    size_t capacity = 64;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    void evict() {
+        while (entries.size() > capacity && !order.empty()) {
+            entries.erase(order.front());
+            order.pop_front();
+        }
+    }
+};
+
+MeshCache& mesh_cache() {
+    static MeshCache cache;
+    return cache;
+}
+
+}  // namespace
+
+// Triangulation of every face of `shape`, in TopExp_Explorer(FACE) order.
+static FaceTriangulations face_triangulations(const TopoDS_Shape& shape) {
+    FaceTriangulations out;
+    for (TopExp_Explorer ex(shape, TopAbs_FACE); ex.More(); ex.Next()) {
+        TopLoc_Location loc;
+        out.push_back(BRep_Tool::Triangulation(TopoDS::Face(ex.Current()), loc));
+    }
+    return out;
+}
+
+// True if the faces of `shape` still carry the triangulations recorded in `expected`.
+static bool has_triangulation(const TopoDS_Shape& shape, const FaceTriangulations& expected) {
+    size_t i = 0;
+    for (TopExp_Explorer ex(shape, TopAbs_FACE); ex.More(); ex.Next(), ++i) {
+        TopLoc_Location loc;
+        if (i >= expected.size() || expected[i].IsNull()) return false;
+        if (BRep_Tool::Triangulation(TopoDS::Face(ex.Current()), loc) != expected[i]) return false;
+    }
+    return i > 0 && i == expected.size();
+}
+
+// Record that `shape` now carries a triangulation meshed with `params`.
+static void remember_mesh(const TopoDS_Shape& shape, const MeshParams& params) {
+    MeshCache& cache = mesh_cache();
+    const TopoDS_TShape* key = shape.TShape().get();
+    MeshEntry entry{shape, params, face_triangulations(shape)};  // face walk outside the lock
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.capacity == 0) return;
+    auto [it, inserted] = cache.entries.insert_or_assign(key, std::move(entry));
+    if (inserted) cache.order.push_back(key);
+    cache.evict();
+}
+
+// Cache lookup for one shape; counts the hit or miss.
+static bool cached_mesh(const TopoDS_Shape& shape, double linear, double angular, bool relative) {
+    MeshCache& cache = mesh_cache();
+    const TopoDS_TShape* key = shape.TShape().get();
+    FaceTriangulations expected;
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto it = cache.entries.find(key);
+        if (it != cache.entries.end()) {
+            const MeshParams& p = it->second.params;
+            if (p.relative == relative && p.linear <= linear && p.angular <= angular) expected = it->second.triangulations;
+        }
+    }
+    const bool hit = !expected.empty() && has_triangulation(shape, expected);  // face walk outside the lock
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        ++(hit ? cache.hits : cache.misses);
+    }
+    return hit;
+}
+
+void mesh_shape(const TopoDS_Shape& shape, double linear, double angular, bool relative, bool parallel) {
+    if (cached_mesh(shape, linear, angular, relative)) return;
+
+    // The 5-arg constructor already meshes the shape (it auto-calls Perform).
+    BRepMesh_IncrementalMesh mesher(shape, linear, relative, angular, parallel);
+    remember_mesh(shape, MeshParams{linear, angular, relative});
+}
+
+void mesh_shapes(const std::vector<TopoDS_Shape>& shapes, double linear, double angular, bool relative) {
+    // shapes still to mesh, one per TShape
+    std::vector<TopoDS_Shape> todo;
+    {
+        std::unordered_set<const TopoDS_TShape*> seen;
+        for (const TopoDS_Shape& shape : shapes)
+            if (!shape.IsNull() && seen.insert(shape.TShape().get()).second && !cached_mesh(shape, linear, angular, relative))
+                todo.push_back(shape);
+    }
+    if (todo.empty()) return;
 
+    // One compound holding every distinct TFace once: two located instances of a face would
+    // otherwise be meshed concurrently into the same triangulation.
+    TopoDS_Compound faces;
+    BRep_Builder builder;
+    builder.MakeCompound(faces);
+    {
+        std::unordered_set<const TopoDS_TShape*> seen;
+        for (const TopoDS_Shape& shape : todo)
+            for (TopExp_Explorer ex(shape, TopAbs_FACE); ex.More(); ex.Next())
+                if (seen.insert(ex.Current().TShape().get()).second) builder.Add(faces, ex.Current());
+    }
+    BRepMesh_IncrementalMesh mesher(faces, linear, relative, angular, true);
+    for (const TopoDS_Shape& shape : todo) remember_mesh(shape, MeshParams{linear, angular, relative});
+}
+
+// (hits, misses, entries)
+static std::tuple<uint64_t, uint64_t, size_t> mesh_cache_stats() {
+    MeshCache& cache = mesh_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    return {cache.hits, cache.misses, cache.entries.size()};
+}
+
+static void mesh_cache_clear() {
+    MeshCache& cache = mesh_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
+    cache.order.clear();
+    cache.hits = 0;
+    cache.misses = 0;
+}
+
+// Maximum number of remembered (and so pinned) shapes; 0 disables the cache (every call meshes).
+static void set_mesh_cache_capacity(size_t capacity) {
+    MeshCache& cache = mesh_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.capacity = capacity;
+    cache.evict();
+}
+
+static size_t mesh_cache_capacity() {
+    MeshCache& cache = mesh_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    return cache.capacity;
+}
+
+// ---------------------------------------------------------------------------
+// tessellation
+// ---------------------------------------------------------------------------
+
+// Plain C++ result of a tessellation pass. Everything is gathered into std::vectors so the
+// whole pass (meshing + extraction) can run with the GIL released; only the final numpy/tuple
+// packaging in the bound function needs it.
+struct Tessellation {
     std::vector<double> verts;  // flat V*3
     std::vector<int> tris;      // flat T*3
-    std::vector<std::vector<Triple>> edges;
+    // Edge polylines in CSR form: polyline p is edge_points[edge_offsets[p] : edge_offsets[p + 1]].
+    std::vector<double> edge_points;   // flat N*3, all polylines back to back
+    std::vector<int> edge_offsets{0};  // P+1
+    std::vector<int> edge_ids;         // P, index of the source edge in TopExp::MapShapes(EDGE) order
+    // Per-node / per-triangle attributes, only gathered when requested (tesselate_arrays).
+    std::vector<double> normals;  // flat V*3, unit, pointing out of the (oriented) face
+    std::vector<double> uvs;      // flat V*2, surface parameters of each node
+    std::vector<int> face_ids;    // T, index of the source face in TopExp_Explorer(FACE) order
+};
+
+struct TessOptions {
+    bool attributes = false;  // gather normals / uvs / face_ids
+    bool welded = false;      // share edge/vertex nodes between adjacent faces
+    bool mesh = true;         // run mesh_shape first (off when the caller has already meshed the shape)
+};
+
+// Mesh `shape` and gather its triangulation. Pure OCCT/STL -- safe to call without the GIL.
+// Triangle winding is flipped for REVERSED faces so the mesh has consistent outward normals.
+//
+// Welded mode: BRepMesh discretises every edge once and each adjacent face references that
+// discretisation through a Poly_PolygonOnTriangulation (same nodes, same parameter order). The
+// k-th polygon node of an edge therefore maps to one global vertex for all faces (and the end
+// nodes to the global vertex of the TopoDS_Vertex), which makes the output watertight. Each edge
+// polyline is then reported once, welded normals are averaged and uvs come from the first face.
+static Tessellation tesselate_shape(const TopoDS_Shape& shape, double linear, double angular, const TessOptions& opts = {}) {
+    if (opts.mesh) mesh_shape(shape, linear, angular, false, true);
+
+    Tessellation t;
+    std::vector<double>& verts = t.verts;
+    std::vector<int>& tris = t.tris;
     int nverts = 0;
+    int face_id = -1;
+
+    TopTools_IndexedMapOfShape vertex_map, edge_map;  // IsSame: both orientations share one entry
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertex_map);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+    // welded mode: global vertex of every TopoDS_Vertex / of every node of every edge polygon
+    std::vector<int> vertex_nodes(opts.welded ? vertex_map.Extent() : 0, -1);
+    std::vector<std::vector<int>> edge_nodes(opts.welded ? edge_map.Extent() : 0);
+    std::vector<char> edge_done(edge_map.Extent(), 0);
 
-    for (TopExp_Explorer ex(s.shape, TopAbs_FACE); ex.More(); ex.Next()) {
+    auto end_polyline = [&](int edge_id) {
+        t.edge_offsets.push_back(static_cast<int>(t.edge_points.size() / 3));
+        t.edge_ids.push_back(edge_id);
+    };
+
+    for (TopExp_Explorer ex(shape, TopAbs_FACE); ex.More(); ex.Next()) {
+        ++face_id;
         TopoDS_Face face = TopoDS::Face(ex.Current());
         TopLoc_Location loc;
         opencascade::handle<Poly_Triangulation> tri = BRep_Tool::Triangulation(face, loc);
         if (tri.IsNull()) continue;
 
         const gp_Trsf trsf = loc.Transformation();
-        const int offset = nverts;
-        for (int i = 1; i <= tri->NbNodes(); ++i) {
+        const bool reversed = (face.Orientation() == TopAbs_REVERSED);
+        // BRepMesh does not store nodal normals; derive them from the surface (stored on the
+        // triangulation, so a cached mesh pays for this once).
+        if (opts.attributes && !tri->HasNormals()) BRepLib_ToolTriangulatedShape::ComputeNormals(face, tri);
+
+        auto normal = [&](int i) {
+            gp_Dir n = tri->Normal(i).Transformed(trsf);
+            if (reversed) n.Reverse();
+            return n;
+        };
+        // append local node i as a new global vertex
+        auto emit = [&](int i) {
             const gp_Pnt p = tri->Node(i).Transformed(trsf);
             verts.push_back(p.X());
             verts.push_back(p.Y());
             verts.push_back(p.Z());
-            ++nverts;
+            if (opts.attributes) {
+                const gp_Dir n = normal(i);
+                t.normals.push_back(n.X());
+                t.normals.push_back(n.Y());
+                t.normals.push_back(n.Z());
+                const gp_Pnt2d uv = tri->HasUVNodes() ? tri->UVNode(i) : gp_Pnt2d(0.0, 0.0);
+                t.uvs.push_back(uv.X());
+                t.uvs.push_back(uv.Y());
+            }
+            return nverts++;
+        };
+
+        // global vertex of each local (1-based) node
+        std::vector<int> index(tri->NbNodes() + 1, -1);
+
+        if (opts.welded) {
+            // bind local node i to the shared global vertex `slot` (created on first use)
+            auto weld = [&](int i, int& slot) {
+                if (index[i] >= 0) {
+                    if (slot < 0) slot = index[i];
+                    return;
+                }
+                if (slot < 0) {
+                    slot = index[i] = emit(i);
+                    return;
+                }
+                index[i] = slot;
+                if (opts.attributes) {
+                    const gp_Dir n = normal(i);
+                    t.normals[slot * 3] += n.X();
+                    t.normals[slot * 3 + 1] += n.Y();
+                    t.normals[slot * 3 + 2] += n.Z();
+                }
+            };
+
+            for (TopExp_Explorer ee(face, TopAbs_EDGE); ee.More(); ee.Next()) {
+                const TopoDS_Edge edge = TopoDS::Edge(ee.Current());
+                opencascade::handle<Poly_PolygonOnTriangulation> pot = BRep_Tool::PolygonOnTriangulation(edge, tri, loc);
+                if (pot.IsNull()) continue;
+                const TColStd_Array1OfInteger& nodes = pot->Nodes();
+                const int n = nodes.Length();
+
+                std::vector<int>& shared = edge_nodes[edge_map.FindIndex(edge) - 1];
+                if (shared.empty()) shared.assign(n, -1);
+                if (static_cast<int>(shared.size()) != n) continue;  // non-conforming polygon: leave unwelded
+
+                TopoDS_Vertex first, last;
+                TopExp::Vertices(edge, first, last);  // in parameter order (orientation ignored)
+                int& v1 = vertex_nodes[vertex_map.FindIndex(first) - 1];
+                int& v2 = vertex_nodes[vertex_map.FindIndex(last) - 1];
+                const bool degenerated = BRep_Tool::Degenerated(edge);
+                for (int k = 0; k < n; ++k) {
+                    const int i = nodes.Value(nodes.Lower() + k);
+                    if (degenerated || k == 0)
+                        weld(i, v1);
+                    else if (k == n - 1)
+                        weld(i, v2);
+                    else
+                        weld(i, shared[k]);
+                }
+            }
         }
+        for (int i = 1; i <= tri->NbNodes(); ++i)
+            if (index[i] < 0) index[i] = emit(i);
 
-        const bool reversed = (face.Orientation() == TopAbs_REVERSED);
         for (int i = 1; i <= tri->NbTriangles(); ++i) {
             Standard_Integer n1, n2, n3;
             tri->Triangle(i).Get(n1, n2, n3);
-            int a = offset + n1 - 1, b = offset + n2 - 1, c = offset + n3 - 1;
+            int a = index[n1], b = index[n2], c = index[n3];
+            if (opts.welded && (a == b || b == c || c == a)) continue;  // collapsed by welding (e.g. at a pole)
             if (reversed) std::swap(b, c);
             tris.push_back(a);
             tris.push_back(b);
             tris.push_back(c);
+            if (opts.attributes) t.face_ids.push_back(face_id);
         }
 
         for (TopExp_Explorer ee(face, TopAbs_EDGE); ee.More(); ee.Next()) {
+            const int e = edge_map.FindIndex(ee.Current()) - 1;
+            if (opts.welded && edge_done[e]) continue;
             opencascade::handle<Poly_PolygonOnTriangulation> pot =
                 BRep_Tool::PolygonOnTriangulation(TopoDS::Edge(ee.Current()), tri, loc);
             if (pot.IsNull()) continue;
-            std::vector<Triple> poly;
+            edge_done[e] = 1;
             const TColStd_Array1OfInteger& nodes = pot->Nodes();
             for (int i = nodes.Lower(); i <= nodes.Upper(); ++i) {
-                const int g = (offset + nodes.Value(i) - 1) * 3;
-                poly.push_back({verts[g], verts[g + 1], verts[g + 2]});
+                const int g = index[nodes.Value(i)] * 3;
+                t.edge_points.insert(t.edge_points.end(), verts.begin() + g, verts.begin() + g + 3);
             }
-            edges.push_back(poly);
+            end_polyline(e);
+        }
+    }
+
+    if (opts.welded && opts.attributes) {
+        for (size_t i = 0; i + 2 < t.normals.size(); i += 3) {
+            const double len = std::sqrt(t.normals[i] * t.normals[i] + t.normals[i + 1] * t.normals[i + 1] +
+                                         t.normals[i + 2] * t.normals[i + 2]);
+            if (len <= 0.0) continue;
+            t.normals[i] /= len;
+            t.normals[i + 1] /= len;
+            t.normals[i + 2] /= len;
         }
     }
 
     // Free edges (not part of any face) -- e.g. the wire produced by a section/slice -- have no
     // triangulation, so discretise their curves directly (cf. compas_occ's to_tesselation).
     TopTools_IndexedMapOfShape face_edges;
-    for (TopExp_Explorer fx(s.shape, TopAbs_FACE); fx.More(); fx.Next())
+    for (TopExp_Explorer fx(shape, TopAbs_FACE); fx.More(); fx.Next())
         for (TopExp_Explorer ex(fx.Current(), TopAbs_EDGE); ex.More(); ex.Next())
             face_edges.Add(ex.Current());
 
-    for (TopExp_Explorer ex(s.shape, TopAbs_EDGE); ex.More(); ex.Next()) {
+    for (TopExp_Explorer ex(shape, TopAbs_EDGE); ex.More(); ex.Next()) {
         if (face_edges.Contains(ex.Current())) continue;
         BRepAdaptor_Curve curve(TopoDS::Edge(ex.Current()));
         GCPnts_TangentialDeflection discretizer(curve, angular, linear);
-        std::vector<Triple> poly;
+        if (discretizer.NbPoints() < 2) continue;
         for (int i = 1; i <= discretizer.NbPoints(); ++i) {
             const gp_Pnt p = discretizer.Value(i);
-            poly.push_back({p.X(), p.Y(), p.Z()});
+            t.edge_points.push_back(p.X());
+            t.edge_points.push_back(p.Y());
+            t.edge_points.push_back(p.Z());
         }
-        if (poly.size() >= 2) edges.push_back(poly);
+        end_polyline(edge_map.FindIndex(ex.Current()) - 1);
+    }
+
+    return t;
+}
+
+// CSR edge polylines -> nested lists of points (the classic third element of tesselate).
+static std::vector<std::vector<Triple>> nested_polylines(const Tessellation& t) {
+    std::vector<std::vector<Triple>> out;
+    out.reserve(t.edge_ids.size());
+    for (size_t p = 0; p + 1 < t.edge_offsets.size(); ++p) {
+        std::vector<Triple> poly;
+        for (int i = t.edge_offsets[p]; i < t.edge_offsets[p + 1]; ++i)
+            poly.push_back({t.edge_points[i * 3], t.edge_points[i * 3 + 1], t.edge_points[i * 3 + 2]});
+        out.push_back(std::move(poly));
+    }
+    return out;
+}
+
+// (points (N,3) float64, offsets (P+1,) int32, edge_ids (P,) int32) as zero-copy numpy arrays.
+static nb::tuple flat_polylines(Tessellation& t) {
+    const size_t N = t.edge_points.size() / 3;
+    const size_t P = t.edge_ids.size();
+    return nb::make_tuple(to_numpy(std::move(t.edge_points), {N, 3}),
+                          to_numpy(std::move(t.edge_offsets), {P + 1}),
+                          to_numpy(std::move(t.edge_ids), {P}));
+}
+
+// Tessellate a shape -> (vertices (V,3) float64, triangles (T,3) int32, edge-polylines).
+// Vertices/triangles are returned as zero-copy numpy arrays. The meshing/extraction phase runs
+// with the GIL released, so concurrent calls from Python threads overlap; only the packaging
+// below runs under the GIL. NOTE: meshing writes the triangulation onto the shape itself, so do
+// not tessellate the *same* shape from several threads at once (distinct shapes are fine).
+// `welded` shares the nodes on face boundaries (compact, watertight indexed mesh).
+// `flat_edges` returns the polylines as (points, offsets, edge_ids) arrays instead of nested
+// lists, which avoids creating one Python object per polyline point.
+static nb::tuple tesselate(const Shape& s, double linear, double angular, bool welded, bool flat_edges) {
+    Tessellation t;
+    std::vector<std::vector<Triple>> edges;
+    {
+        nb::gil_scoped_release release;
+        TessOptions opts;
+        opts.welded = welded;
+        t = tesselate_shape(s.shape, linear, angular, opts);
+        if (!flat_edges) edges = nested_polylines(t);
+    }
+    const size_t V = t.verts.size() / 3;
+    const size_t T = t.tris.size() / 3;
+    nb::object polylines = flat_edges ? nb::object(flat_polylines(t)) : nb::cast(edges);
+    return nb::make_tuple(to_numpy(std::move(t.verts), {V, 3}), to_numpy(std::move(t.tris), {T, 3}), polylines);
+}
+
+// Package an attribute tessellation as the tesselate_arrays dict (needs the GIL).
+static nb::dict arrays_dict(Tessellation& t) {
+    const size_t V = t.verts.size() / 3;
+    const size_t T = t.tris.size() / 3;
+    nb::dict out;
+    out["vertices"] = to_numpy(std::move(t.verts), {V, 3});
+    out["triangles"] = to_numpy(std::move(t.tris), {T, 3});
+    out["normals"] = to_numpy(std::move(t.normals), {V, 3});
+    out["uvs"] = to_numpy(std::move(t.uvs), {V, 2});
+    out["face_ids"] = to_numpy(std::move(t.face_ids), {T});
+    nb::tuple polylines = flat_polylines(t);
+    out["edge_points"] = polylines[0];
+    out["edge_offsets"] = polylines[1];
+    out["edge_ids"] = polylines[2];
+    return out;
+}
+
+// Rendering-ready tessellation -> dict of zero-copy numpy arrays:
+//   vertices (V,3) float64, triangles (T,3) int32, normals (V,3) float64 (unit, outward),
+//   uvs (V,2) float64 (surface parameters), face_ids (T,) int32 (index into the shape's faces),
+//   edge_points (N,3) float64, edge_offsets (P+1,) int32, edge_ids (P,) int32 (CSR polylines).
+// Same GIL split as tesselate.
+static nb::dict tesselate_arrays(const Shape& s, double linear, double angular, bool welded) {
+    Tessellation t;
+    {
+        nb::gil_scoped_release release;
+        TessOptions opts;
+        opts.attributes = true;
+        opts.welded = welded;
+        t = tesselate_shape(s.shape, linear, angular, opts);
     }
+    return arrays_dict(t);
+}
+
+// Tessellate many shapes in one call -> (vertices (V,3) float64, triangles (T,3) int32,
+// vertex_offsets (S+1,) int32, triangle_offsets (S+1,) int32).
+// Shape i owns vertices[vertex_offsets[i]:vertex_offsets[i+1]] and the same slice of triangles;
+// triangle indices are global (into the concatenated vertices), so the whole batch can be
+// uploaded as one buffer. Runs entirely on OCCT's thread pool with the GIL released:
+//   1. every distinct face is meshed once, in a single parallel BRepMesh run (instances of one
+//      part -- same TShape, different Location -- would otherwise race writing the same
+//      triangulation),
+//   2. the triangulations are extracted per shape in parallel (read-only),
+//   3. the per-shape buffers are copied into the concatenated arrays in parallel.
+static nb::tuple tesselate_many(const std::vector<Shape>& shapes, double linear, double angular) {
+    const int S = static_cast<int>(shapes.size());
+    std::vector<double> verts;
+    std::vector<int> tris;
+    std::vector<int> vertex_offsets(S + 1, 0);
+    std::vector<int> triangle_offsets(S + 1, 0);
+    {
+        nb::gil_scoped_release release;
 
-    const size_t V = static_cast<size_t>(nverts);
+        std::vector<TopoDS_Shape> batch;
+        batch.reserve(shapes.size());
+        for (const Shape& s : shapes) batch.push_back(s.shape);
+        mesh_shapes(batch, linear, angular, false);
+
+        std::vector<Tessellation> parts(S);
+        TessOptions opts;
+        opts.mesh = false;
+        OSD_Parallel::For(0, S, [&](int i) {
+            if (!shapes[i].shape.IsNull()) parts[i] = tesselate_shape(shapes[i].shape, linear, angular, opts);
+        });
+
+        for (int i = 0; i < S; ++i) {
+            vertex_offsets[i + 1] = vertex_offsets[i] + static_cast<int>(parts[i].verts.size() / 3);
+            triangle_offsets[i + 1] = triangle_offsets[i] + static_cast<int>(parts[i].tris.size() / 3);
+        }
+        verts.resize(static_cast<size_t>(vertex_offsets[S]) * 3);
+        tris.resize(static_cast<size_t>(triangle_offsets[S]) * 3);
+        OSD_Parallel::For(0, S, [&](int i) {
+            std::copy(parts[i].verts.begin(), parts[i].verts.end(), verts.begin() + vertex_offsets[i] * 3);
+            const int base = vertex_offsets[i];
+            int* out = tris.data() + static_cast<size_t>(triangle_offsets[i]) * 3;
+            for (int index : parts[i].tris) *out++ = index + base;
+        });
+    }
+    const size_t V = verts.size() / 3;
     const size_t T = tris.size() / 3;
-    return nb::make_tuple(to_numpy(std::move(verts), {V, 3}), to_numpy(std::move(tris), {T, 3}), nb::cast(edges));
+    return nb::make_tuple(to_numpy(std::move(verts), {V, 3}), to_numpy(std::move(tris), {T, 3}),
+                          to_numpy(std::move(vertex_offsets), {size_t(S) + 1}),
+                          to_numpy(std::move(triangle_offsets), {size_t(S) + 1}));
+}
+
+// Level-of-detail pyramid -> list of tesselate_arrays dicts (plus "linear"/"angular"), one per
+// (linear, angular) level, ordered coarsest first whatever the input order, so a streaming viewer
+// can show levels[0] at once and refine later. All levels are meshed and extracted in one
+// GIL-free pass on a copy of the shape (new TShapes, shared geometry, no triangulation):
+//   - the caller's shape keeps whatever triangulation it carries, so a coarse level never
+//     replaces a finer mesh that tesselate / the triangulation cache rely on;
+//   - each finer level is an incremental BRepMesh run on the copy: faces/edges whose current
+//     discretisation already satisfies the level (planar faces, straight edges, ...) are kept as
+//     they are and only the rest is re-meshed.
+static nb::list tesselate_lods(const Shape& s, std::vector<std::pair<double, double>> levels, bool welded) {
+    if (levels.empty()) throw std::invalid_argument("tesselate_lods: at least one (linear, angular) level is required");
+    for (const auto& [linear, angular] : levels)
+        if (!(linear > 0.0) || !(angular > 0.0)) throw std::invalid_argument("tesselate_lods: deflections must be positive");
+    std::stable_sort(levels.begin(), levels.end(), [](const auto& a, const auto& b) {
+        return a.first != b.first ? a.first > b.first : a.second > b.second;
+    });
+
+    std::vector<Tessellation> parts(levels.size());
+    {
+        nb::gil_scoped_release release;
+        const TopoDS_Shape work = BRepBuilderAPI_Copy(s.shape, Standard_False, Standard_False).Shape();
+        TessOptions opts;
+        opts.attributes = true;
+        opts.welded = welded;
+        opts.mesh = false;
+        for (size_t i = 0; i < levels.size(); ++i) {
+            const auto [linear, angular] = levels[i];
+            BRepMesh_IncrementalMesh mesher(work, linear, Standard_False, angular, Standard_True);
+            parts[i] = tesselate_shape(work, linear, angular, opts);
+        }
+    }
+    nb::list out;
+    for (size_t i = 0; i < levels.size(); ++i) {
+        nb::dict level = arrays_dict(parts[i]);
+        level["linear"] = levels[i].first;
+        level["angular"] = levels[i].second;
+        out.append(level);
+    }
+    return out;
 }
 
 static Shape triangle_to_face(const std::vector<Triple>& points) {
@@ -120,22 +619,66 @@ static Shape triangle_to_face(const std::vector<Triple>& points) {
     return Shape(BRepBuilderAPI_MakeFace(polygon.Wire()).Face());
 }
 
-static Shape quad_to_face(const std::vector<Triple>& points) {
+// Bilinear (ruled) surface through the quad corners p0 p1 p2 p3.
+static opencascade::handle<Geom_Surface> ruled_quad_surface(const gp_Pnt& p0, const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3) {
     TColgp_Array1OfPnt a1(1, 2);
-    a1.SetValue(1, to_pnt(points[0]));
-    a1.SetValue(2, to_pnt(points[1]));
+    a1.SetValue(1, p0);
+    a1.SetValue(2, p1);
     TColgp_Array1OfPnt a2(1, 2);
-    a2.SetValue(1, to_pnt(points[3]));
-    a2.SetValue(2, to_pnt(points[2]));
+    a2.SetValue(1, p3);
+    a2.SetValue(2, p2);
     opencascade::handle<Geom_BSplineCurve> c1 = GeomAPI_PointsToBSpline(a1).Curve();
     opencascade::handle<Geom_BSplineCurve> c2 = GeomAPI_PointsToBSpline(a2).Curve();
-    opencascade::handle<Geom_Surface> srf = GeomFill::Surface(c1, c2);
+    return GeomFill::Surface(c1, c2);
+}
+
+static Shape quad_to_face(const std::vector<Triple>& points) {
+    opencascade::handle<Geom_Surface> srf =
+        ruled_quad_surface(to_pnt(points[0]), to_pnt(points[1]), to_pnt(points[2]), to_pnt(points[3]));
     return Shape(BRepBuilderAPI_MakeFace(srf, 1e-6).Face());
 }
 
-static Shape ngon_to_face(const std::vector<Triple>& points) {
+// Best-fit plane of a polygon if all its points lie within `tolerance` of it. The normal is the
+// Newell normal, so it follows the winding of the points (right-hand rule).
+static bool fit_plane(const std::vector<gp_Pnt>& points, double tolerance, gp_Pln& plane) {
+    const size_t n = points.size();
+    gp_XYZ normal(0.0, 0.0, 0.0), centroid(0.0, 0.0, 0.0);
+    for (size_t i = 0; i < n; ++i) {
+        const gp_XYZ& a = points[i].XYZ();
+        const gp_XYZ& b = points[(i + 1) % n].XYZ();
+        normal += gp_XYZ((a.Y() - b.Y()) * (a.Z() + b.Z()), (a.Z() - b.Z()) * (a.X() + b.X()), (a.X() - b.X()) * (a.Y() + b.Y()));
+        centroid += a;
+    }
+    if (normal.Modulus() <= gp::Resolution()) return false;  // degenerate (collinear) polygon
+    plane = gp_Pln(gp_Pnt(centroid / static_cast<double>(n)), gp_Dir(normal));
+    for (const gp_Pnt& p : points)
+        if (plane.Distance(p) > tolerance) return false;
+    return true;
+}
+
+// Face of one n-gon. Planar polygons (within `tolerance`) get a plane through the points
+// projected onto it -- as cheap as triangle_to_face; non-planar quads get the ruled surface of
+// quad_to_face and only larger non-planar polygons pay for the N-sided BRepFill_Filling fit.
+static TopoDS_Face ngon_face(const std::vector<Triple>& coords, double tolerance) {
+    if (coords.size() < 3) throw std::invalid_argument("ngon_to_face: a polygon needs at least three points.");
+    std::vector<gp_Pnt> points;
+    points.reserve(coords.size());
+    for (const auto& p : coords) points.push_back(to_pnt(p));
+
+    gp_Pln plane;
+    if (fit_plane(points, tolerance, plane)) {
+        const gp_Vec normal(plane.Axis().Direction());
+        BRepBuilderAPI_MakePolygon polygon;
+        for (const gp_Pnt& p : points) polygon.Add(p.Translated(-normal * gp_Vec(plane.Location(), p).Dot(normal)));
+        polygon.Close();
+        BRepBuilderAPI_MakeFace face(plane, polygon.Wire(), Standard_True);
+        if (face.IsDone()) return face.Face();
+    }
+    if (points.size() == 4)
+        return BRepBuilderAPI_MakeFace(ruled_quad_surface(points[0], points[1], points[2], points[3]), 1e-6).Face();
+
     BRepBuilderAPI_MakePolygon polygon;
-    for (const auto& p : points) polygon.Add(to_pnt(p));
+    for (const gp_Pnt& p : points) polygon.Add(p);
     polygon.Build();
     polygon.Close();
     BRepFill_Filling nsided;
@@ -143,16 +686,173 @@ static Shape ngon_to_face(const std::vector<Triple>& points) {
         nsided.Add(TopoDS::Edge(ex.Current()), GeomAbs_C0);
     }
     nsided.Build();
-    return Shape(nsided.Face());
+    return nsided.Face();
+}
+
+static Shape ngon_to_face(const std::vector<Triple>& points, double tolerance) {
+    return Shape(ngon_face(points, tolerance));
+}
+
+// Batch ngon_to_face: the faces are independent, so they are built on OCCT's thread pool with
+// the GIL released.
+static std::vector<Shape> ngons_to_faces(const std::vector<std::vector<Triple>>& polygons, double tolerance) {
+    for (const auto& polygon : polygons)
+        if (polygon.size() < 3) throw std::invalid_argument("ngons_to_faces: a polygon needs at least three points.");
+    std::vector<Shape> faces(polygons.size());
+    std::vector<std::string> errors(polygons.size());
+    {
+        nb::gil_scoped_release release;
+        OSD_Parallel::For(0, static_cast<int>(polygons.size()), [&](int i) {
+            try {
+                faces[i] = Shape(ngon_face(polygons[i], tolerance));
+            } catch (const Standard_Failure& e) {
+                errors[i] = e.GetMessageString();
+            } catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+        });
+    }
+    for (size_t i = 0; i < errors.size(); ++i)
+        if (!errors[i].empty()) throw std::runtime_error("ngons_to_faces: polygon " + std::to_string(i) + ": " + errors[i]);
+    return faces;
+}
+
+// ---------------------------------------------------------------------------
+// mesh -> shell (vectorised)
+// ---------------------------------------------------------------------------
+
+using VertexArray = nb::ndarray<const double, nb::shape<-1, 3>, nb::c_contig, nb::device::cpu>;
+using IndexArray = nb::ndarray<const int32_t, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+
+// Face bounded by `wire` (polygon through `points`, already built from shared edges).
+// Polygons within `tolerance` of their best-fit plane (the common case) get that plane, like
+// ngon_face; otherwise quads get the same bilinear ruled surface as quad_to_face and larger
+// polygons an N-sided filling surface. The shared edges carry no pcurves on those surfaces yet
+// (and lie off a nearly-planar face by up to `tolerance`), so ShapeFix_Face adds the pcurves and
+// raises the tolerances. The fix may replace shared edges/vertices: it records that in `context`,
+// which the caller applies to the whole shell so the neighbouring faces pick the changes up.
+static TopoDS_Face polygon_face(const TopoDS_Wire& wire, const std::vector<gp_Pnt>& points, double tolerance,
+                                const opencascade::handle<ShapeBuild_ReShape>& context) {
+    TopoDS_Face face;
+    gp_Pln plane;
+    if (fit_plane(points, tolerance, plane)) {
+        BRepBuilderAPI_MakeFace planar(plane, wire, Standard_True);
+        if (planar.IsDone()) {
+            double deviation = 0.0;
+            for (const gp_Pnt& p : points) deviation = std::max(deviation, plane.Distance(p));
+            if (deviation <= Precision::Confusion()) return planar.Face();
+            face = planar.Face();
+        }
+    }
+    if (face.IsNull()) {
+        opencascade::handle<Geom_Surface> srf;
+        if (points.size() == 4) {
+            srf = ruled_quad_surface(points[0], points[1], points[2], points[3]);
+        } else {
+            BRepFill_Filling nsided;
+            for (TopExp_Explorer ex(wire, TopAbs_EDGE); ex.More(); ex.Next()) nsided.Add(TopoDS::Edge(ex.Current()), GeomAbs_C0);
+            nsided.Build();
+            if (!nsided.IsDone()) throw std::runtime_error("mesh_to_shell: failed to fit a surface to a non-planar face.");
+            TopLoc_Location loc;
+            srf = BRep_Tool::Surface(nsided.Face(), loc);
+        }
+        BRepBuilderAPI_MakeFace maker(srf, wire, Standard_True);
+        if (!maker.IsDone()) throw std::runtime_error("mesh_to_shell: failed to build a non-planar face.");
+        face = maker.Face();
+    }
+    ShapeFix_Face fix(face);
+    fix.SetContext(context);
+    fix.Perform();
+    return fix.Face();
+}
+
+// Shell from a face-vertex mesh -> Shape (TopoDS_Shell).
+//   vertices (V,3) float64; indices: all face loops back to back; offsets (F+1,): face f is
+//   indices[offsets[f]:offsets[f+1]] (triangles/quads are just offsets 0,3,6,... / 0,4,8,...).
+// One TopoDS_Vertex per mesh vertex and one TopoDS_Edge per undirected mesh edge are shared by
+// all faces using them, so the shell comes out sewn (no BRepBuilderAPI_Sewing pass needed).
+// Consecutive duplicate indices are dropped and faces left with < 3 corners are skipped; faces
+// within `tolerance` of a plane are planar (see polygon_face).
+// Everything after the argument checks runs with the GIL released.
+static Shape mesh_to_shell(const VertexArray& vertices, const IndexArray& indices, const IndexArray& offsets, double tolerance) {
+    const int64_t V = static_cast<int64_t>(vertices.shape(0));
+    const int64_t F = offsets.shape(0) > 0 ? static_cast<int64_t>(offsets.shape(0)) - 1 : 0;
+    const double* xyz = vertices.data();
+    const int32_t* idx = indices.data();
+    const int32_t* off = offsets.data();
+    if (F > 0 && (off[0] != 0 || off[F] != static_cast<int64_t>(indices.shape(0))))
+        throw std::invalid_argument("mesh_to_shell: offsets must start at 0 and end at len(indices).");
+    for (int64_t f = 0; f < F; ++f)
+        if (off[f + 1] < off[f]) throw std::invalid_argument("mesh_to_shell: offsets must be non-decreasing.");
+    for (size_t i = 0; i < indices.shape(0); ++i)
+        if (idx[i] < 0 || idx[i] >= V) throw std::invalid_argument("mesh_to_shell: vertex index out of range.");
+
+    TopoDS_Shell shell;
+    {
+        nb::gil_scoped_release release;
+        BRep_Builder builder;
+        builder.MakeShell(shell);
+        opencascade::handle<ShapeBuild_ReShape> context = new ShapeBuild_ReShape;
+
+        std::vector<TopoDS_Vertex> shared_vertices(V);
+        std::unordered_map<uint64_t, TopoDS_Edge> shared_edges;
+        auto point = [&](int32_t v) { return gp_Pnt(xyz[v * 3], xyz[v * 3 + 1], xyz[v * 3 + 2]); };
+        auto vertex = [&](int32_t v) -> const TopoDS_Vertex& {
+            if (shared_vertices[v].IsNull()) builder.MakeVertex(shared_vertices[v], point(v), Precision::Confusion());
+            return shared_vertices[v];
+        };
+        // the edge is built once from the lower to the higher index and used REVERSED the other way
+        auto edge = [&](int32_t a, int32_t b) {
+            const int32_t lo = std::min(a, b), hi = std::max(a, b);
+            const uint64_t key = (static_cast<uint64_t>(lo) << 32) | static_cast<uint32_t>(hi);
+            auto it = shared_edges.find(key);
+            if (it == shared_edges.end())
+                it = shared_edges.emplace(key, BRepBuilderAPI_MakeEdge(vertex(lo), vertex(hi)).Edge()).first;
+            return a == lo ? it->second : TopoDS::Edge(it->second.Reversed());
+        };
+
+        std::vector<int32_t> loop;
+        std::vector<gp_Pnt> points;
+        for (int64_t f = 0; f < F; ++f) {
+            loop.clear();
+            for (int32_t i = off[f]; i < off[f + 1]; ++i)
+                if (loop.empty() || loop.back() != idx[i]) loop.push_back(idx[i]);
+            while (loop.size() > 1 && loop.front() == loop.back()) loop.pop_back();
+            if (loop.size() < 3) continue;
+
+            TopoDS_Wire wire;
+            builder.MakeWire(wire);
+            points.clear();
+            for (size_t i = 0; i < loop.size(); ++i) {
+                builder.Add(wire, edge(loop[i], loop[(i + 1) % loop.size()]));
+                points.push_back(point(loop[i]));
+            }
+            wire.Closed(Standard_True);
+            builder.Add(shell, polygon_face(wire, points, tolerance, context));
+        }
+        shell = TopoDS::Shell(context->Apply(shell));
+    }
+    return Shape(shell);
 }
 
 void register_meshing(nb::module_& m) {
-    // NOTE: do NOT add a blanket nb::gil_scoped_release here -- tesselate builds the nb::ndarray
-    // / nb::tuple return value inside its body, which requires the GIL. (Releasing it only around
-    // the internal BRepMesh call would need manual scoping inside tesselate.)
-    m.def("tesselate", &tesselate);
+    // NOTE: do NOT add a blanket nb::call_guard<nb::gil_scoped_release> to tesselate -- it builds
+    // the nb::ndarray / nb::tuple return value inside its body, which requires the GIL. It releases
+    // the GIL itself, scoped around the meshing/extraction phase (see tesselate_shape).
+    m.def("tesselate", &tesselate, "shape"_a, "linear"_a, "angular"_a, "welded"_a = false, "flat_edges"_a = false);
+    m.def("tesselate_arrays", &tesselate_arrays, "shape"_a, "linear"_a, "angular"_a, "welded"_a = false);
+    m.def("tesselate_many", &tesselate_many, "shapes"_a, "linear"_a, "angular"_a);
+    m.def("tesselate_lods", &tesselate_lods, "shape"_a, "levels"_a, "welded"_a = false);
+    m.def("mesh_cache_stats", &mesh_cache_stats);
+    m.def("mesh_cache_clear", &mesh_cache_clear);
+    m.def("set_mesh_cache_capacity", &set_mesh_cache_capacity, "capacity"_a,
+          "Keep at most `capacity` shapes in the triangulation cache (default 64, 0 disables it). Each entry holds "
+          "its shape, so cached shapes and their face triangulations stay alive until evicted or cleared.");
+    m.def("mesh_cache_capacity", &mesh_cache_capacity);
     m.def("triangle_to_face", &triangle_to_face);
     m.def("quad_to_face", &quad_to_face);
-    m.def("ngon_to_face", &ngon_to_face);
+    m.def("ngon_to_face", &ngon_to_face, "points"_a, "tolerance"_a = 1e-6);
+    m.def("ngons_to_faces", &ngons_to_faces, "polygons"_a, "tolerance"_a = 1e-6);
+    m.def("mesh_to_shell", &mesh_to_shell, "vertices"_a, "indices"_a, "offsets"_a, "tolerance"_a = 1e-6);
     // shell_from_faces is registered by register_make (brep_make.cpp).
 }
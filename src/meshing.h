@@ -0,0 +1,21 @@
+// meshing.h - the BRepMesh entry point shared by every path that needs a triangulated shape
+// (tesselate in meshing.cpp, write_stl in io.cpp, overlap in brep_boolean.cpp).
+#pragma once
+
+#include <TopoDS_Shape.hxx>
+
+#include <vector>
+
+// Make sure `shape` carries a triangulation at least as fine as (linear, angular).
+//
+// BRepMesh stores the triangulation on the shape's faces, so a shape that was already meshed
+// with deflections <= the requested ones does not need to be meshed again. A small cache keyed
+// on the shape's TShape remembers the (linear, angular, relative) each shape was meshed with;
+// on a hit only the extraction is left to the caller. Thread-safe (the meshing itself runs
+// outside the cache lock). Statistics/size are exposed as mesh_cache_* in register_meshing.
+void mesh_shape(const TopoDS_Shape& shape, double linear, double angular, bool relative, bool parallel);
+
+// mesh_shape for a batch: every shape that misses the cache is meshed in one parallel BRepMesh
+// run over the distinct faces of the batch, so shapes sharing faces (located instances, parts
+// reused across assemblies) never mesh the same triangulation concurrently.
+void mesh_shapes(const std::vector<TopoDS_Shape>& shapes, double linear, double angular, bool relative);
@@ -0,0 +1,32 @@
+// streams.h - read-only std::streambuf over a caller-owned byte buffer, shared by the in-memory
+// readers in io.cpp and the unpickling in types.cpp: OCCT's stream readers parse Python bytes /
+// buffers in place instead of from a copy.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <streambuf>
+
+// The buffer must outlive the stream reading from it. Seeking is supported (BinTools and the STEP
+// reader seek), writing is not.
+class MemoryBuffer : public std::streambuf {
+public:
+    MemoryBuffer(const uint8_t* data, size_t size) {
+        char* begin = reinterpret_cast<char*>(const_cast<uint8_t*>(data));  // never written through
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) return pos_type(off_type(-1));
+        char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+        char* target = base + off;
+        if (target < eback() || target > egptr()) return pos_type(off_type(-1));
+        setg(eback(), target, egptr());
+        return pos_type(target - eback());
+    }
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
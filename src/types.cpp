@@ -1,11 +1,131 @@
 // types.cpp - register the 4 opaque OCCT handle wrappers in the _occt module.
 #include "compas.h"
 #include "handles.h"
+#include "streams.h"
 
-void register_types(nb::module_& m) {
-    nb::class_<Shape>(m, "Shape", "Opaque wrapper around an OCCT TopoDS_Shape.");
-    nb::class_<GeomCurve>(m, "GeomCurve", "Opaque wrapper around an OCCT Geom_Curve handle.");
-    nb::class_<Geom2dCurve>(m, "Geom2dCurve", "Opaque wrapper around an OCCT Geom2d_Curve handle.");
-    nb::class_<GeomSurface>(m, "GeomSurface", "Opaque wrapper around an OCCT Geom_Surface handle.");
+#include <cstdint>
+#include <istream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include <BinTools.hxx>
+#include <BinTools_Curve2dSet.hxx>
+#include <BinTools_CurveSet.hxx>
+#include <BinTools_FormatVersion.hxx>
+#include <BinTools_OStream.hxx>
+#include <BinTools_SurfaceSet.hxx>
+
+// ---------------------------------------------------------------------------
+// pickling
+// ---------------------------------------------------------------------------
+//
+// Every wrapper pickles as (version, bytes) with the payload in OCCT's binary format: BinTools for
+// shapes (topology sharing included; face triangulations are not, as they are often larger than the
+// B-rep itself, so a receiver that needs a mesh meshes it through the cache) and the BinTools_*Set
+// record of a single curve / p-curve / surface. No text formatting or COMPAS data
+// conversion is involved, so sending geometry to worker processes costs about a buffer copy. An empty
+// payload is a null shape / handle. Encoding and decoding run with the GIL released.
+
+static constexpr int kPickleVersion = 1;
+
+using PickleState = std::tuple<int, nb::bytes>;
+
+// Encode with `write` (GIL released) -> (version, bytes).
+template <typename Write>
+static nb::tuple pickle_state(Write&& write) {
+    std::ostringstream out(std::ios::binary);
+    {
+        nb::gil_scoped_release release;
+        write(out);
+    }
+    const std::string bytes = out.str();
+    return nb::make_tuple(kPickleVersion, nb::bytes(bytes.data(), bytes.size()));
+}
+
+// Decode the payload of `state` with `read` (GIL released); `read` is not called for an empty payload.
+template <typename Read>
+static void unpickle_state(const PickleState& state, Read&& read) {
+    if (std::get<0>(state) != kPickleVersion)
+        throw std::invalid_argument("Unsupported pickle version " + std::to_string(std::get<0>(state)) + ".");
+    const nb::bytes& data = std::get<1>(state);
+    if (data.size() == 0) return;
+    MemoryBuffer buffer(reinterpret_cast<const uint8_t*>(data.c_str()), data.size());  // in place, no copy
+    std::istream in(&buffer);
+    nb::gil_scoped_release release;
+    read(in);
+}
+
+static nb::tuple shape_getstate(const Shape& s) {
+    return pickle_state([&](std::ostream& out) {
+        if (s.shape.IsNull()) return;
+        if (!BinTools::Write(s.shape, out, Standard_False, Standard_False, BinTools_FormatVersion_CURRENT))
+            throw std::runtime_error("Failed to pickle shape.");
+    });
+}
+
+static void shape_setstate(Shape& s, const PickleState& state) {
+    TopoDS_Shape shape;
+    unpickle_state(state, [&](std::istream& in) {
+        if (!BinTools::Read(shape, in)) throw std::runtime_error("Failed to unpickle shape.");
+    });
+    new (&s) Shape(shape);
+}
+
+static nb::tuple curve_getstate(const GeomCurve& c) {
+    return pickle_state([&](std::ostream& out) {
+        if (c.curve.IsNull()) return;
+        BinTools_OStream stream(out);
+        BinTools_CurveSet::WriteCurve(c.curve, stream);
+    });
+}
+
+static void curve_setstate(GeomCurve& c, const PickleState& state) {
+    opencascade::handle<Geom_Curve> curve;
+    unpickle_state(state, [&](std::istream& in) { BinTools_CurveSet::ReadCurve(in, curve); });
+    new (&c) GeomCurve(curve);
+}
+
+static nb::tuple curve2d_getstate(const Geom2dCurve& c) {
+    return pickle_state([&](std::ostream& out) {
+        if (c.curve.IsNull()) return;
+        BinTools_OStream stream(out);
+        BinTools_Curve2dSet::WriteCurve2d(c.curve, stream);
+    });
+}
+
+static void curve2d_setstate(Geom2dCurve& c, const PickleState& state) {
+    opencascade::handle<Geom2d_Curve> curve;
+    unpickle_state(state, [&](std::istream& in) { BinTools_Curve2dSet::ReadCurve2d(in, curve); });
+    new (&c) Geom2dCurve(curve);
 }
 
+static nb::tuple surface_getstate(const GeomSurface& s) {
+    return pickle_state([&](std::ostream& out) {
+        if (s.surface.IsNull()) return;
+        BinTools_OStream stream(out);
+        BinTools_SurfaceSet::WriteSurface(s.surface, stream);
+    });
+}
+
+static void surface_setstate(GeomSurface& s, const PickleState& state) {
+    opencascade::handle<Geom_Surface> surface;
+    unpickle_state(state, [&](std::istream& in) { BinTools_SurfaceSet::ReadSurface(in, surface); });
+    new (&s) GeomSurface(surface);
+}
+
+void register_types(nb::module_& m) {
+    nb::class_<Shape>(m, "Shape", "Opaque wrapper around an OCCT TopoDS_Shape.")
+        .def("__getstate__", &shape_getstate)
+        .def("__setstate__", &shape_setstate);
+    nb::class_<GeomCurve>(m, "GeomCurve", "Opaque wrapper around an OCCT Geom_Curve handle.")
+        .def("__getstate__", &curve_getstate)
+        .def("__setstate__", &curve_setstate);
+    nb::class_<Geom2dCurve>(m, "Geom2dCurve", "Opaque wrapper around an OCCT Geom2d_Curve handle.")
+        .def("__getstate__", &curve2d_getstate)
+        .def("__setstate__", &curve2d_setstate);
+    nb::class_<GeomSurface>(m, "GeomSurface", "Opaque wrapper around an OCCT Geom_Surface handle.")
+        .def("__getstate__", &surface_getstate)
+        .def("__setstate__", &surface_setstate);
+}
@@ -1,5 +1,13 @@
+import math
+
+import pytest
+
 from compas.geometry import Box
+from compas.geometry import Frame
+from compas.geometry import Polygon
+from compas.geometry import Sphere
 from compas.tolerance import TOL
+from compas_occt import _occt
 from compas_occt.brep import OCCBrep
 
 
@@ -37,3 +45,208 @@ def test_overlap_intersection():
     assert isinstance(common, OCCBrep)
     assert len(common.faces) == 1
     assert TOL.is_close(common.area, 0.7 * 0.5)  # the shared rectangle on the x = 0.5 plane
+
+
+def test_boolean_parallel_matches_serial():
+    a = OCCBrep.from_box(Box(2))
+    b = OCCBrep.from_box(Box(1))
+    serial = a.boolean_difference(b, parallel=False)
+    parallel = a.boolean_difference(b, parallel=True)
+    assert TOL.is_close(serial.volume, parallel.volume)
+
+    assert _occt.boolean_parallel() is False
+    _occt.set_boolean_parallel(True)
+    try:
+        assert TOL.is_close(OCCBrep.from_boolean_union(a, b).volume, 8.0)
+    finally:
+        _occt.set_boolean_parallel(False)
+
+
+@pytest.fixture
+def thread_pool_size():
+    # the pool is process-wide: give it back to later tests the way it was
+    original = _occt.thread_pool_size()
+    yield
+    _occt.set_thread_pool_size(original)
+
+
+def test_thread_pool_size(thread_pool_size):
+    _occt.set_thread_pool_size(2)
+    assert _occt.thread_pool_size() == 2
+    _occt.set_thread_pool_size(0)
+    assert _occt.thread_pool_size() >= 1
+
+
+def test_boolean_batch():
+    plate = OCCBrep.from_box(Box(4)).occ_shape
+    holes = [OCCBrep.from_sphere(Sphere(0.5, point=[x, 0, 0])).occ_shape for x in (-1, 0, 1)]
+    jobs = [("difference", [plate], [hole], 1e-6) for hole in holes]
+    jobs.append(("union", [plate], holes, 1e-6))
+    jobs.append(("intersection", [plate], [holes[1]], 1e-6))
+
+    results = _occt.boolean_batch(jobs)
+    assert len(results) == len(jobs)
+    assert all(shape is not None and error == "" for shape, error in results)
+
+    sphere = 4 / 3 * 3.141592653589793 * 0.5**3
+    volumes = [OCCBrep.from_native(shape).volume for shape, _ in results]
+    for volume in volumes[:3]:
+        assert TOL.is_close(volume, 64 - sphere, rtol=1e-3)
+    assert TOL.is_close(volumes[3], 64.0, rtol=1e-3)
+    assert TOL.is_close(volumes[4], sphere, rtol=1e-3)
+    # the shared plate is left untouched (jobs run non-destructively)
+    assert TOL.is_close(OCCBrep.from_native(plate).volume, 64.0)
+
+    with pytest.raises(ValueError):
+        _occt.boolean_batch([("xor", [plate], [holes[0]], 1e-6)])
+
+
+def test_boolean_operations_shared_intersection():
+    a = OCCBrep.from_box(Box(2))
+    b = OCCBrep.from_box(Box(2).translated([1, 0, 0]))
+    results = OCCBrep.from_boolean_operations(a, b, ("union", "difference", "intersection", "section"))
+
+    assert list(results) == ["union", "difference", "intersection", "section"]
+    assert TOL.is_close(results["union"].volume, 12.0)
+    assert TOL.is_close(results["difference"].volume, 4.0)
+    assert TOL.is_close(results["intersection"].volume, 4.0)
+    assert len(results["section"].edges) > 0
+    # same results as the one-by-one constructors
+    assert TOL.is_close(OCCBrep.from_boolean_union(a, b).volume, results["union"].volume)
+
+
+def test_boolean_options():
+    options = _occt.BooleanOptions(use_obb=True, glue="shift", fill_history=False)
+    assert options.glue == "shift" and options.use_obb and not options.fill_history
+    with pytest.raises(ValueError):
+        options.glue = "sideways"
+
+    # a row of boxes sharing faces: the glue modes give the same solid as the plain fuse
+    boxes = [OCCBrep.from_box(Box(1).translated([i, 0, 0])) for i in range(4)]
+    expected = OCCBrep.from_boolean_union(boxes[:1], boxes[1:]).volume
+    for glue in ("off", "shift", "full"):
+        options = _occt.BooleanOptions(use_obb=True, glue=glue, non_destructive=True, fill_history=False)
+        fused = OCCBrep.from_boolean_union(boxes[:1], boxes[1:], options=options)
+        assert TOL.is_close(fused.volume, expected)
+        assert TOL.is_close(expected, 4.0)
+
+    pieces = boxes[0].split(OCCBrep.from_box(Box(2).translated([0.5, 0.5, 0])), options=_occt.BooleanOptions(use_obb=True))
+    assert len(pieces) > 1
+
+
+def test_boolean_async_jobs():
+    a = OCCBrep.from_box(Box(2))
+    b = OCCBrep.from_box(Box(2).translated([1, 0, 0]))
+
+    job = _occt.boolean_union_async([a.native_brep], [b.native_brep], 1e-6)
+    assert job.wait(30.0)
+    assert job.done() and job.status() == "done"
+    assert job.progress() == 1.0
+    assert TOL.is_close(OCCBrep.from_native(job.result()).volume, 12.0)
+
+    job = _occt.boolean_difference_async([a.native_brep], [b.native_brep], 1e-6, timeout=30.0)
+    assert TOL.is_close(OCCBrep.from_native(job.result()).volume, 4.0)
+
+    job = _occt.fillet_async(a.native_brep, 0.1, [])
+    assert OCCBrep.from_native(job.result()).volume < 8.0
+
+    job = _occt.offset_async(a.native_brep, 0.1)
+    assert job.result() is not None
+
+    # the deadline is checked before the job starts, so an expired one always stops it
+    job = _occt.boolean_intersection_async([a.native_brep], [b.native_brep], 1e-6, timeout=0.0)
+    job.wait()
+    assert job.status() == "timed out"
+    with pytest.raises(RuntimeError):
+        job.result()
+
+    # a cancelled job either finished first or reports the cancellation
+    job = _occt.boolean_union_async([a.native_brep], [b.native_brep], 1e-6)
+    job.cancel()
+    job.wait()
+    assert job.status() in ("done", "cancelled")
+
+
+def test_proximity_index():
+    a = OCCBrep.from_box(Box(1))
+    touching = Box(1)
+    touching.translate([1, 0.3, 0.5])  # face-to-face with A at x = 0.5
+    far = Box(1)
+    far.translate([5, 0, 0])
+
+    index = a.proximity_index()
+    assert index.face_count == len(a.faces)
+
+    candidates = [OCCBrep.from_box(touching), OCCBrep.from_box(far)]
+    pairs = index.query(candidates[0].native_brep)
+    assert pairs.shape[1] == 2 and len(pairs) >= 1
+    # the same faces as the one-off overlap
+    faces1, faces2 = a.overlap(candidates[0])
+    assert {int(i) for i in pairs[:, 0]} == {next(k for k, face in enumerate(a.faces) if face.is_same(f)) for f in faces1}
+    assert {int(j) for j in pairs[:, 1]} == {next(k for k, face in enumerate(candidates[0].faces) if face.is_same(f)) for f in faces2}
+
+    pairs, offsets = index.query_many([c.native_brep for c in candidates] * 3)
+    assert offsets.shape == (7,) and offsets[0] == 0 and offsets[-1] == len(pairs)
+    counts = offsets[1:] - offsets[:-1]
+    assert counts[0] >= 1 and counts[1] == 0
+    assert list(counts[:2]) * 3 == list(counts)
+
+
+def test_fillet_edges():
+    box = OCCBrep.from_box(Box(2))
+    edges = _occt.shape_map(box.native_brep, 6)
+    assert len(edges) == 12  # each shared edge once
+    assert _occt.shape_map_indices(box.native_brep, 6, edges[3:5]) == [3, 4]
+
+    # one edge, constant radius: the removed corner is (1 - pi / 4) * r^2 along the edge length
+    brep = OCCBrep.from_box(Box(2))
+    brep.fillet_edges([brep.edges[0]], 0.2)
+    assert TOL.is_close(brep.volume, 8.0 - (1 - math.pi / 4) * 0.04 * 2.0, rtol=1e-3)
+
+    # per-edge and variable radii
+    brep = OCCBrep.from_box(Box(2))
+    single = OCCBrep.from_box(Box(2))
+    single.fillet_edges([single.edges[0]], 0.2)
+    brep.fillet_edges([brep.edges[0]], [0.2], end_radii=[0.4])
+    assert brep.volume < single.volume
+
+    with pytest.raises(ValueError):
+        brep.fillet_edges([OCCBrep.from_box(Box(1)).edges[0]], 0.1)
+
+
+def test_split_grouped():
+    slabs = [OCCBrep.from_box(Box(4, 1, 0.5)), OCCBrep.from_box(Box(4, 1, 0.5, frame=Frame([0, 3, 0])))]
+    cuts = [OCCBrep.from_polygons([Polygon([[x, -1, -1], [x, 4, -1], [x, 4, 1], [x, -1, 1]])], solid=False) for x in (-1, 0, 1)]
+
+    groups = OCCBrep.from_split(slabs, cuts, parallel=True)
+    assert len(groups) == 2
+    for group, slab in zip(groups, slabs):
+        assert len(group) == 4
+        assert TOL.is_close(sum(piece.volume for piece in group), slab.volume)
+        assert all(TOL.is_close(piece.volume, 0.5) for piece in group)
+    assert all(piece.centroid.y > 2 for piece in groups[1])
+
+    # the flat split gives the same pieces
+    assert len(slabs[0].split(cuts[1], tol=1e-6)) == 2
+
+
+def test_boolean_with_history():
+    a = OCCBrep.from_box(Box(2))
+    b = OCCBrep.from_box(Box(2).translated([1, 0, 0]))
+
+    brep, history = OCCBrep.from_boolean_with_history(a, b, "union")
+    faces, offsets, deleted = history["faces"], history["offsets"], history["deleted"]
+    assert offsets.shape == (13,) and offsets[0] == 0 and offsets[-1] == len(faces)
+    # the two faces inside the other box disappear, every other input face maps to exactly one output face
+    assert len(deleted) == 2
+    counts = offsets[1:] - offsets[:-1]
+    assert all(counts[f] == (0 if f in deleted else 1) for f in range(12))
+    assert sorted(faces.tolist()) == list(range(len(brep.faces)))
+    assert history["generated_offsets"].shape == (13,)
+
+    # attributes follow their faces: the -x face of A stays at x = -1
+    minus_x = next(f for f, face in enumerate(a.faces) if TOL.is_close(face.centroid.x, -1))
+    assert TOL.is_close(brep.faces[faces[offsets[minus_x]]].centroid.x, -1)
+
+    with pytest.raises(ValueError):
+        OCCBrep.from_boolean_with_history(a, b, "xor")
@@ -1,9 +1,14 @@
-import pytest
+import math
 import random
 
+import numpy as np
+import pytest
+
 from compas.geometry import Box
 from compas.geometry import Cylinder
 from compas.geometry import Frame
+from compas.geometry import Plane
+from compas.geometry import Polygon
 from compas.geometry import Sphere
 from compas.tolerance import TOL
 from compas_occt.brep import OCCBrep
@@ -48,6 +53,16 @@ def test_brep_from_sphere():
     assert sphere.frame.point == brep.centroid
 
 
+def test_brep_from_polygons_planar_quads():
+    box = Box(2)
+    polygons = [Polygon([box.points[index] for index in face]) for face in box.faces]
+    brep = OCCBrep.from_polygons(polygons)
+
+    assert len(brep.faces) == 6
+    assert all(face.is_plane for face in brep.faces)
+    assert TOL.is_close(abs(brep.volume), box.volume)
+
+
 def test_brep_caches_invalidated_on_transform():
     """In-place transform must invalidate the cached topology and properties."""
     from compas.geometry import Translation
@@ -64,3 +79,38 @@ def test_brep_caches_invalidated_on_transform():
     assert TOL.is_close(brep.centroid.x, c_before.x + 10)
     # rigid transform preserves volume
     assert TOL.is_close(brep.volume, 1.0)
+
+
+def test_brep_contours():
+    sphere = OCCBrep.from_sphere(Sphere(1))
+    heights = [-0.5, 0.0, 0.5, 2.0]
+    contours = sphere.contours([Plane([0, 0, z], [0, 0, 1]) for z in heights])
+
+    assert len(contours) == len(heights)
+    assert contours[3] == []  # above the sphere
+    for z, polylines in zip(heights[:3], contours[:3]):
+        points = [point for polyline in polylines for point in polyline.points]
+        assert points
+        radius = math.sqrt(1 - z**2)
+        assert all(abs(point.z - z) < 1e-6 for point in points)
+        assert all(abs(math.hypot(point.x, point.y) - radius) < 1e-2 for point in points)
+
+    # layers as base plane + offsets, flat arrays
+    offsets = np.linspace(-0.9, 0.9, 19)
+    points, ends, plane_ids = sphere.contour_arrays(offsets[:, None] * [0, 0, 1], [[0, 0, 1]])
+    assert ends[0] == 0 and ends[-1] == len(points)
+    assert sorted(set(plane_ids.tolist())) == list(range(19))
+
+
+def test_brep_contours_oblique_planes():
+    # the face index must also find the faces cut by planes that are not axis aligned
+    box = OCCBrep.from_box(Box(2))
+    normal = [1 / math.sqrt(3)] * 3
+    contours = box.contours([Plane([0, 0, 0], normal), Plane([0.5, 0, 0], normal), Plane([5, 5, 5], normal)])
+
+    assert len(contours[0]) == 1 and len(contours[1]) == 1
+    assert contours[2] == []
+    hexagon = contours[0][0]
+    assert hexagon.is_closed
+    assert len(hexagon.points) == 7  # six sides, first point repeated
+    assert all(abs(sum(point)) < 1e-6 for point in hexagon.points)
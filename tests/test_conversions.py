@@ -1,9 +1,18 @@
+import math
+
+import numpy as np
 import pytest
 
+from compas.datastructures import Mesh
+from compas.geometry import Box
 from compas.geometry import Pointcloud
 from compas.tolerance import TOL
+from compas_occt.brep import OCCBrep
 from compas_occt.conversions import array1_from_points1
+from compas_occt.conversions import arrays_to_occ_shell
 from compas_occt.conversions import harray1_from_points1
+from compas_occt.conversions import ngon_to_face
+from compas_occt.conversions import ngons_to_faces
 from compas_occt.conversions import points1_from_array1
 
 
@@ -60,3 +69,59 @@ def test_points1_from_array1(points1):
         assert TOL.is_close(point.x, item.X())
         assert TOL.is_close(point.y, item.Y())
         assert TOL.is_close(point.z, item.Z())
+
+
+def test_arrays_to_occ_shell_is_sewn():
+    mesh = Mesh.from_shape(Box(2))
+    vertices, faces = mesh.to_vertices_and_faces()
+    brep = OCCBrep.from_native(arrays_to_occ_shell(np.array(vertices), np.array(faces)))
+
+    # adjacent faces share their edges: no free edges left, no sewing needed
+    assert len(brep.faces) == 6
+    assert brep.is_closed
+
+    brep.make_solid()
+    assert TOL.is_close(abs(brep.volume), 8.0)
+
+
+def test_arrays_to_occ_shell_offsets():
+    # a planar pentagon next to a non-planar quad, sharing the edge (0, 1)
+    vertices = np.array([[0, 0, 0], [1, 0, 0], [1.5, 1, 0], [0.5, 1.5, 0], [-0.5, 1, 0], [1, -1, 0.5], [0, -1, 0]], dtype=float)
+    indices = np.array([0, 1, 2, 3, 4, 1, 0, 6, 5])
+    shell = arrays_to_occ_shell(vertices, indices, [0, 5, 9])
+    brep = OCCBrep.from_native(shell)
+    assert len(brep.faces) == 2
+
+    with pytest.raises(ValueError):
+        arrays_to_occ_shell(vertices, [0, 1, 99], [0, 3])
+
+
+def test_arrays_to_occ_shell_tolerance():
+    # two quads sharing an edge, one corner out of plane by 1e-3
+    vertices = np.array([[0, 0, 0], [1, 0, 0], [1, 1, 1e-3], [0, 1, 0], [2, 0, 0], [2, 1, 0]], dtype=float)
+    faces = np.array([[0, 1, 2, 3], [1, 4, 5, 2]])
+
+    loose = OCCBrep.from_native(arrays_to_occ_shell(vertices, faces, tolerance=1e-2))
+    assert all(face.is_plane for face in loose.faces)
+    assert all(face.is_valid() for face in loose.faces)
+
+    strict = OCCBrep.from_native(arrays_to_occ_shell(vertices, faces))
+    assert not any(face.is_plane for face in strict.faces)
+    assert all(face.is_valid() for face in strict.faces)
+
+
+def test_ngon_to_face_planar_fast_path():
+    hexagon = [[math.cos(i * math.pi / 3), math.sin(i * math.pi / 3), 0.0] for i in range(6)]
+    face = OCCBrep.from_native(ngon_to_face(hexagon)).faces[0]
+    assert face.is_plane
+    assert TOL.is_close(face.area, 1.5 * math.sqrt(3))
+
+    # out of plane by 1e-3: planar with a loose tolerance, a fitted surface with the default one
+    bumped = [point[:2] + [1e-3 * (i % 2)] for i, point in enumerate(hexagon)]
+    assert OCCBrep.from_native(ngon_to_face(bumped, tolerance=1e-2)).faces[0].is_plane
+    assert not OCCBrep.from_native(ngon_to_face(bumped)).faces[0].is_plane
+
+    faces = ngons_to_faces([hexagon, bumped, hexagon[:3]])
+    assert len(faces) == 3
+    with pytest.raises(ValueError):
+        ngons_to_faces([hexagon[:2]])
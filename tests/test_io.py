@@ -1,9 +1,17 @@
+import json
+import re
+import struct
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 
 from compas.geometry import Box
+from compas.geometry import Line
 from compas.geometry import Sphere
 from compas.tolerance import TOL
+from compas_occt import _occt
 from compas_occt.brep import OCCBrep
+from compas_occt.geometry import OCCCurve
 
 
 @pytest.mark.parametrize("fmt", ["step", "iges"])
@@ -56,7 +64,187 @@ def test_stl_write(tmp_path):
     assert path.exists() and path.stat().st_size > 0
 
 
+def test_ply_write(tmp_path):
+    path = tmp_path / "shape.ply"
+    OCCBrep.from_box(Box(1)).to_ply(path, 0.1, 0.5)
+    data = path.read_bytes()
+    header, body = data.split(b"end_header\n", 1)
+    assert b"format binary_little_endian 1.0" in header
+    assert b"element vertex 24" in header
+    assert b"element face 12" in header
+    # float32 xyz per vertex, then (uchar 3, 3 x int32) per face
+    assert len(body) == 24 * 12 + 12 * 13
+
+
+def test_glb_write(tmp_path):
+    path = tmp_path / "shape.glb"
+    OCCBrep.from_sphere(Sphere(1)).to_glb(path, 0.01, 0.2)
+    data = path.read_bytes()
+
+    magic, version, length = struct.unpack_from("<4sII", data, 0)
+    assert (magic, version, length) == (b"glTF", 2, len(data))
+    json_length, json_type = struct.unpack_from("<I4s", data, 12)
+    assert json_type == b"JSON"
+    gltf = json.loads(data[20 : 20 + json_length])
+    positions, indices = gltf["accessors"]
+    bin_length, bin_type = struct.unpack_from("<I4s", data, 20 + json_length)
+    assert bin_type == b"BIN\x00"
+    assert bin_length == positions["count"] * 12 + indices["count"] * 4
+    assert all(abs(value) <= 1 + 1e-6 for value in positions["max"] + positions["min"])
+
+    offset = 28 + json_length + positions["count"] * 12
+    assert max(struct.unpack_from("<%dI" % indices["count"], data, offset)) < positions["count"]
+
+
 def test_brep_write(tmp_path):
     path = tmp_path / "shape.brep"
     OCCBrep.from_box(Box(1)).to_brep(path)
     assert path.exists() and path.stat().st_size > 0
+
+
+def test_read_many_matches_serial_reads(tmp_path):
+    n = 16
+    paths = []
+    for i in range(n):
+        brep = OCCBrep.from_box(Box(1 + 0.25 * i))
+        path = tmp_path / ("shape_{}.{}".format(i, "step" if i % 2 == 0 else "iges"))
+        getattr(brep, "to_" + path.suffix[1:])(path)
+        paths.append(path)
+
+    def summary(brep):
+        return len(brep.faces), round(brep.volume, 6)
+
+    serial = [summary(OCCBrep.from_native(_occt.read_step(str(p)) if p.suffix == ".step" else _occt.read_iges(str(p)))) for p in paths]
+
+    # the batch reader
+    batch = [summary(brep) for brep in OCCBrep.from_files(paths)]
+    assert batch == serial
+
+    # N files on N Python threads, each through the single-file readers
+    def read(p):
+        return summary(OCCBrep.from_native(_occt.read_step(str(p)) if p.suffix == ".step" else _occt.read_iges(str(p))))
+
+    for _ in range(3):
+        with ThreadPoolExecutor(max_workers=n) as pool:
+            assert list(pool.map(read, paths)) == serial
+
+    # a failing file does not abort the batch
+    results = _occt.read_many([str(paths[0]), str(tmp_path / "missing.step")])
+    assert results[0][0] is not None and results[0][1] == ""
+    assert results[1][0] is None and results[1][1]
+    with pytest.raises(RuntimeError):
+        OCCBrep.from_files([paths[0], tmp_path / "missing.step"])
+    with pytest.raises(ValueError):
+        _occt.read_many([str(tmp_path / "shape.obj")])
+
+
+def test_step_writer_settings_are_per_call(tmp_path):
+    brep = OCCBrep.from_box(Box(2))
+    curve = OCCCurve.from_line(Line([0, 0, 0], [1, 0, 0]))
+    jobs = [("MM", "AP203"), ("INCH", "AP214"), ("M", "AP242")] * 4
+
+    def write(i):
+        unit, schema = jobs[i]
+        brep.to_step(tmp_path / "brep_{}.step".format(i), unit=unit, name="part_{}".format(i))
+        curve.to_step(tmp_path / "curve_{}.step".format(i), schema=schema)
+
+    with ThreadPoolExecutor(max_workers=len(jobs)) as pool:
+        list(pool.map(write, range(len(jobs))))
+
+    units = {"MM": ".MILLI.,.METRE.", "INCH": "'INCH'", "M": "$,.METRE."}
+    schemas = {"AP203": "CONFIG_CONTROL_DESIGN", "AP214": "AUTOMOTIVE_DESIGN", "AP242": "AP242_MANAGED_MODEL_BASED_3D_ENGINEERING"}
+    for i, (unit, schema) in enumerate(jobs):
+        text = (tmp_path / "brep_{}.step".format(i)).read_text()
+        assert units[unit] in text
+        assert "'part_{}'".format(i) in text
+        assert schemas[schema] in (tmp_path / "curve_{}.step".format(i)).read_text()
+
+    with pytest.raises(ValueError):
+        brep.to_step(tmp_path / "bad.step", unit="parsec")
+
+
+def test_step_schema_names(tmp_path):
+    curve = OCCCurve.from_line(Line([0, 0, 0], [1, 0, 0]))
+
+    def file_schema(schema):
+        path = tmp_path / "curve_{}.step".format(schema)
+        curve.to_step(path, schema=schema)
+        return re.search(r"FILE_SCHEMA\s*\(\s*\(\s*'([^']*)'", path.read_text()).group(1)
+
+    names = ["AP203", "AP214CD", "AP214DIS", "AP214IS", "AP242DIS"]
+    headers = {name: file_schema(name) for name in names}
+    assert len(set(headers.values())) == len(names)  # every schema writes its own header
+
+    assert headers["AP203"].startswith("CONFIG_CONTROL_DESIGN")
+    assert headers["AP214CD"].startswith("AUTOMOTIVE_DESIGN_CC2")
+    for name in ("AP214DIS", "AP214IS"):
+        assert headers[name].startswith("AUTOMOTIVE_DESIGN") and "CC2" not in headers[name]
+    assert headers["AP242DIS"].startswith("AP242_MANAGED_MODEL_BASED_3D_ENGINEERING")
+
+    # short aliases
+    assert file_schema("AP214") == headers["AP214CD"]
+    assert file_schema("AP242") == headers["AP242DIS"]
+
+    with pytest.raises(ValueError):
+        curve.to_step(tmp_path / "bad.step", schema="AP999")
+
+
+@pytest.mark.parametrize("fmt", ["step", "iges", "brep"])
+def test_bytes_roundtrip(fmt):
+    brep = OCCBrep.from_box(Box(2))
+    data = brep.to_bytes(fmt)
+    assert isinstance(data, bytes) and len(data) > 0
+
+    other = OCCBrep.from_bytes(memoryview(data), fmt)
+    if fmt == "iges":
+        other.make_solid()
+    assert len(other.faces) == 6
+    assert TOL.is_close(other.volume, brep.volume)
+
+
+def test_iges_bytes_concurrent_reads():
+    # every read gets its own temporary file
+    data = OCCBrep.from_box(Box(2)).to_bytes("iges")
+    with ThreadPoolExecutor(max_workers=8) as pool:
+        breps = list(pool.map(lambda _: OCCBrep.from_bytes(data, "iges"), range(16)))
+    assert all(len(brep.faces) == 6 for brep in breps)
+
+
+def test_bytes_match_files(tmp_path):
+    brep = OCCBrep.from_box(Box(2))
+    brep.to_brep(tmp_path / "box.brep")
+    assert OCCBrep.from_bytes((tmp_path / "box.brep").read_bytes(), "brep").faces
+
+    data = brep.to_bytes("stl", ascii=False)
+    (count,) = struct.unpack("<I", data[80:84])
+    assert count >= 12 and len(data) == 84 + 50 * count
+
+    # the same writer as to_stl: identical output, ASCII by default
+    text = brep.to_bytes("stl")
+    assert text.startswith(b"solid") and text.count(b"facet normal") == count
+    brep.to_stl(tmp_path / "box.stl")
+    assert (tmp_path / "box.stl").read_bytes() == text
+    brep.to_stl(tmp_path / "box_binary.stl", ascii=False)
+    assert (tmp_path / "box_binary.stl").read_bytes() == data
+
+    with pytest.raises(ValueError):
+        brep.to_bytes("obj")
+
+
+def test_binary_brep_roundtrip(tmp_path):
+    brep = OCCBrep.from_box(Box(2)) - OCCBrep.from_sphere(Sphere(1.2))
+    brep.to_brep(tmp_path / "text.brep")
+    brep.to_brep(tmp_path / "shape.bbrep", binary=True)
+    assert (tmp_path / "shape.bbrep").stat().st_size < (tmp_path / "text.brep").stat().st_size
+
+    other = OCCBrep.from_brep(tmp_path / "shape.bbrep", binary=True)
+    assert len(other.faces) == len(brep.faces)
+    assert TOL.is_close(other.volume, brep.volume)
+
+    # the triangulation travels with the shape when asked for
+    _occt.tesselate(brep.occ_shape, 0.01, 0.1)
+    bare = brep.to_bytes("brep_binary")
+    meshed = brep.to_bytes("brep_binary", triangulation=True)
+    assert len(meshed) > len(bare)
+    other = OCCBrep.from_bytes(meshed, "brep_binary")
+    assert TOL.is_close(other.volume, brep.volume)
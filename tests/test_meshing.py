@@ -0,0 +1,218 @@
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+import pytest
+
+from compas.geometry import Box
+from compas.geometry import Cylinder
+from compas.geometry import Sphere
+from compas.geometry import Torus
+from compas.geometry import Translation
+from compas_occt import _occt
+from compas_occt.brep import OCCBrep
+from compas_occt.conversions import compas_transformation_to_trsf
+
+
+def test_tesselate_concurrent_matches_serial():
+    # distinct shapes per thread: the meshing phase runs with the GIL released
+    shapes = [OCCBrep.from_sphere(Sphere(1 + i)).occ_shape for i in range(4)]
+    serial = [_occt.tesselate(shape, 0.01, 0.1) for shape in shapes]
+
+    shapes = [OCCBrep.from_sphere(Sphere(1 + i)).occ_shape for i in range(4)]
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        threaded = list(pool.map(lambda shape: _occt.tesselate(shape, 0.01, 0.1), shapes))
+
+    for (v1, t1, e1), (v2, t2, e2) in zip(serial, threaded):
+        assert np.allclose(v1, v2)
+        assert np.array_equal(t1, t2)
+        assert len(e1) == len(e2)
+
+
+def test_tesselate_box_and_torus():
+    vertices, triangles, edges = _occt.tesselate(OCCBrep.from_box(Box(1)).occ_shape, 0.1, 0.5)
+    assert len(triangles) == 12
+    assert len(edges) == 24  # each of the 12 box edges is reported once per adjacent face
+
+    vertices, triangles, _ = _occt.tesselate(OCCBrep.from_torus(Torus(2, 0.5)).occ_shape, 0.01, 0.1)
+    assert triangles.max() < len(vertices)
+
+
+@pytest.fixture
+def mesh_cache():
+    # the cache is process-wide: start empty and give the capacity back to later tests
+    original = _occt.mesh_cache_capacity()
+    _occt.set_mesh_cache_capacity(0)
+    _occt.set_mesh_cache_capacity(original)
+    _occt.mesh_cache_clear()
+    yield
+    _occt.set_mesh_cache_capacity(original)
+
+
+def test_triangulation_cache_reuses_existing_mesh(mesh_cache):
+    shape = OCCBrep.from_sphere(Sphere(1)).occ_shape
+
+    first = _occt.tesselate(shape, 0.01, 0.1)
+    assert _occt.mesh_cache_stats()[:2] == (0, 1)
+
+    # same or coarser request -> only the extraction runs
+    second = _occt.tesselate(shape, 0.01, 0.1)
+    third = _occt.tesselate(shape, 0.1, 0.5)
+    hits, misses, entries = _occt.mesh_cache_stats()
+    assert (hits, misses, entries) == (2, 1, 1)
+    assert np.array_equal(first[1], second[1]) and np.array_equal(first[1], third[1])
+
+    # finer request -> re-mesh
+    _occt.tesselate(shape, 0.001, 0.1)
+    assert _occt.mesh_cache_stats()[1] == 2
+
+
+def test_triangulation_cache_can_be_disabled(mesh_cache):
+    _occt.set_mesh_cache_capacity(0)
+    shape = OCCBrep.from_box(Box(1)).occ_shape
+    _occt.tesselate(shape, 0.1, 0.5)
+    _occt.tesselate(shape, 0.1, 0.5)
+    hits, misses, entries = _occt.mesh_cache_stats()
+    assert (hits, misses, entries) == (0, 2, 0)
+
+
+def test_tesselate_arrays_attributes():
+    brep = OCCBrep.from_sphere(Sphere(2))
+    arrays = brep.to_tesselation_arrays(0.01, 0.1)
+    vertices, normals = arrays["vertices"], arrays["normals"]
+
+    assert normals.shape == vertices.shape
+    assert arrays["uvs"].shape == (len(vertices), 2)
+    assert arrays["face_ids"].shape == (len(arrays["triangles"]),)
+    assert arrays["face_ids"].flags["OWNDATA"] is False
+
+    # sphere at the origin: outward unit normals are the normalised positions
+    assert np.allclose(np.linalg.norm(normals, axis=1), 1.0)
+    assert np.allclose(normals, vertices / np.linalg.norm(vertices, axis=1)[:, None], atol=1e-6)
+
+
+def test_tesselate_arrays_face_ids():
+    brep = OCCBrep.from_box(Box(1))
+    arrays = brep.to_tesselation_arrays()
+    face_ids = arrays["face_ids"]
+    assert sorted(set(face_ids.tolist())) == list(range(len(brep.faces)))
+    # box faces are planar: every node normal of a triangle equals the face normal of that triangle
+    for a, b, c in arrays["triangles"]:
+        normal = np.cross(arrays["vertices"][b] - arrays["vertices"][a], arrays["vertices"][c] - arrays["vertices"][a])
+        normal /= np.linalg.norm(normal)
+        assert np.allclose(arrays["normals"][a], normal)
+
+
+def test_tesselate_welded_box_is_watertight():
+    shape = OCCBrep.from_box(Box(1)).occ_shape
+    vertices, triangles, edges = _occt.tesselate(shape, 0.1, 0.5, welded=True)
+    assert len(vertices) == 8
+    assert len(triangles) == 12
+    assert len(edges) == 12
+
+    # every undirected mesh edge is shared by exactly two triangles, with opposite directions
+    directed = {(int(a), int(b)) for tri in triangles for a, b in zip(tri, np.roll(tri, -1))}
+    assert len(directed) == 36
+    assert all((b, a) in directed for a, b in directed)
+
+
+def test_tesselate_welded_cylinder_is_compact():
+    brep = OCCBrep.from_cylinder(Cylinder(1, 2))
+    split, _, _ = _occt.tesselate(brep.occ_shape, 0.01, 0.1)
+    welded, triangles, _ = _occt.tesselate(brep.occ_shape, 0.01, 0.1, welded=True)
+    assert len(welded) < len(split)
+    # no duplicated positions are left (the seam and both rims are shared)
+    assert len(np.unique(np.round(welded, 9), axis=0)) == len(welded)
+    assert triangles.max() < len(welded)
+
+    mesh, _ = brep.to_tesselation(0.01, 0.1, welded=True)
+    assert mesh.is_closed()
+
+
+def test_tesselate_flat_edges():
+    shape = OCCBrep.from_box(Box(1)).occ_shape
+    _, _, nested = _occt.tesselate(shape, 0.1, 0.5)
+    _, _, (points, offsets, edge_ids) = _occt.tesselate(shape, 0.1, 0.5, flat_edges=True)
+
+    assert points.shape == (sum(len(polyline) for polyline in nested), 3)
+    assert offsets.shape == (len(nested) + 1,)
+    assert edge_ids.shape == (len(nested),)
+    assert offsets[0] == 0 and offsets[-1] == len(points)
+    assert points.flags["OWNDATA"] is False
+    for polyline, start, end in zip(nested, offsets[:-1], offsets[1:]):
+        assert np.allclose(points[start:end], polyline)
+
+    # 12 distinct box edges, each seen from its two adjacent faces
+    assert sorted(set(edge_ids.tolist())) == list(range(12))
+    assert np.all(np.bincount(edge_ids) == 2)
+
+
+def test_tesselate_arrays_edges():
+    brep = OCCBrep.from_box(Box(1))
+    arrays = brep.to_tesselation_arrays(welded=True)
+    assert len(arrays["edge_ids"]) == 12
+    assert arrays["edge_offsets"][-1] == len(arrays["edge_points"])
+
+    mesh, polylines = brep.to_tesselation(welded=True)
+    assert len(polylines) == 12
+    assert all(len(polyline.points) == 2 for polyline in polylines)
+
+
+def test_tesselate_many_matches_tesselate():
+    shapes = [OCCBrep.from_box(Box(1)).occ_shape, OCCBrep.from_sphere(Sphere(1)).occ_shape, OCCBrep.from_box(Box(2)).occ_shape]
+    vertices, triangles, vertex_offsets, triangle_offsets = _occt.tesselate_many(shapes, 0.01, 0.1)
+
+    assert vertex_offsets.shape == triangle_offsets.shape == (len(shapes) + 1,)
+    assert vertex_offsets[-1] == len(vertices) and triangle_offsets[-1] == len(triangles)
+    for i, shape in enumerate(shapes):
+        v, t, _ = _occt.tesselate(shape, 0.01, 0.1)
+        assert np.allclose(vertices[vertex_offsets[i] : vertex_offsets[i + 1]], v)
+        # triangle indices are global: shifted by the vertex offset of the shape
+        assert np.array_equal(triangles[triangle_offsets[i] : triangle_offsets[i + 1]], t + vertex_offsets[i])
+
+
+def test_tesselate_many_shared_instances():
+    # located instances of one part share their TShape (and so their triangulation)
+    shape = OCCBrep.from_sphere(Sphere(1)).occ_shape
+    instances = [_occt.transform(shape, compas_transformation_to_trsf(Translation.from_vector([3 * i, 0, 0])), False) for i in range(8)]
+    instances += [shape, shape]
+    vertices, triangles, vertex_offsets, _ = _occt.tesselate_many(instances, 0.01, 0.1)
+    counts = np.diff(vertex_offsets)
+    assert np.all(counts == counts[0])
+    assert triangles.max() < len(vertices)
+    assert _occt.tesselate_many([], 0.01, 0.1)[2].tolist() == [0]
+
+    # distinct assemblies reusing the same part share faces, not their top-level TShape
+    assemblies = [_occt.compound_from_shapes(instances[i : i + 2]) for i in range(0, 8, 2)]
+    _, _, vertex_offsets, _ = _occt.tesselate_many(assemblies, 0.01, 0.1)
+    counts = np.diff(vertex_offsets)
+    assert np.all(counts == counts[0])
+
+
+def test_tesselate_lods_coarse_to_fine():
+    brep = OCCBrep.from_sphere(Sphere(1))
+    lods = brep.to_tesselation_lods([(0.001, 0.1), (0.1, 0.5), (0.01, 0.2)])
+
+    assert [lod["linear"] for lod in lods] == [0.1, 0.01, 0.001]
+    counts = [len(lod["triangles"]) for lod in lods]
+    assert counts == sorted(counts) and counts[0] < counts[-1]
+    for lod in lods:
+        assert lod["vertices"].flags["OWNDATA"] is False
+        assert lod["triangles"].max() < len(lod["vertices"])
+
+    # the levels are meshed on a copy: the brep itself is still unmeshed
+    _occt.mesh_cache_clear()
+    _occt.tesselate(brep.occ_shape, 0.1, 0.5)
+    assert _occt.mesh_cache_stats()[:2] == (0, 1)
+
+
+def test_tesselate_lods_after_fine_mesh():
+    brep = OCCBrep.from_sphere(Sphere(1))
+    fine, _, _ = _occt.tesselate(brep.occ_shape, 0.001, 0.1)
+    # a coarse level is really coarse even though the shape already carries a finer triangulation
+    (coarse,) = _occt.tesselate_lods(brep.occ_shape, [(0.1, 0.5)])
+    assert len(coarse["vertices"]) < len(fine)
+    # ... and the fine triangulation is still on the shape (a cache hit)
+    hits, _, _ = _occt.mesh_cache_stats()
+    again, _, _ = _occt.tesselate(brep.occ_shape, 0.001, 0.1)
+    assert _occt.mesh_cache_stats()[0] == hits + 1
+    assert len(again) == len(fine)
@@ -0,0 +1,76 @@
+import copy
+import pickle
+from concurrent.futures import ProcessPoolExecutor
+
+import pytest
+
+from compas.geometry import Box
+from compas.geometry import Point
+from compas.geometry import Sphere
+from compas.tolerance import TOL
+from compas_occt import _occt
+from compas_occt.brep import OCCBrep
+from compas_occt.geometry import OCCNurbsCurve
+
+
+def test_pickle_shape():
+    brep = OCCBrep.from_box(Box(2)) - OCCBrep.from_sphere(Sphere(1.2))
+    state = brep.native_brep.__getstate__()
+    assert state[0] == 1 and isinstance(state[1], bytes)
+
+    shape = pickle.loads(pickle.dumps(brep.native_brep))
+    other = OCCBrep.from_native(shape)
+    assert len(other.faces) == len(brep.faces)
+    assert TOL.is_close(other.volume, brep.volume)
+
+
+def test_pickle_shape_without_triangulation():
+    brep = OCCBrep.from_sphere(Sphere(1))
+    _occt.tesselate(brep.occ_shape, 0.001, 0.1)
+    state = brep.native_brep.__getstate__()
+    # the payload is the bare B-rep, not the fine mesh on the faces
+    assert len(state[1]) < len(brep.to_bytes("brep_binary", triangulation=True))
+    other = pickle.loads(pickle.dumps(brep))
+    vertices, triangles, _ = _occt.tesselate(other.occ_shape, 0.001, 0.1)
+    assert len(triangles) > 0 and triangles.max() < len(vertices)
+
+
+def test_pickle_geometry():
+    curve = OCCNurbsCurve.from_points([Point(-1, -1, 1), Point(0, 0.5, 1), Point(1, -0.5, 1)]).native_curve
+    face = OCCBrep.from_box(Box(2)).faces[0]
+    surface = _occt.surface_from_face(face.occ_face)
+    top = next(f for f in OCCBrep.from_box(Box(2)).faces if TOL.is_close(f.centroid.z, 1))
+    curve2d = _occt.curve_embedded(curve, _occt.surface_from_face(top.occ_face))
+
+    for native, point_at in (
+        (curve, lambda c: _occt.curve_point_at(c, 0.5)),
+        (curve2d, lambda c: _occt.curve2d_point_at(c, 0.5)),
+        (surface, lambda s: _occt.surface_point_at(s, 0.25, 0.5)),
+    ):
+        for other in (pickle.loads(pickle.dumps(native)), copy.deepcopy(native)):
+            assert type(other) is type(native)
+            assert TOL.is_allclose(point_at(other), point_at(native))
+
+    with pytest.raises(ValueError):
+        _occt.GeomCurve.__new__(_occt.GeomCurve).__setstate__((99, b""))
+
+
+def test_pickle_brep():
+    brep = OCCBrep.from_box(Box(2))
+    brep.name = "block"
+    brep.faces  # populate the caches; they are not pickled
+    other = pickle.loads(pickle.dumps(brep))
+    assert other.name == "block"
+    assert other.guid == brep.guid
+    assert TOL.is_close(other.volume, 8.0)
+
+
+def _volume(brep):
+    return brep.volume
+
+
+def test_breps_to_worker_processes():
+    breps = [OCCBrep.from_box(Box(i + 1)) for i in range(4)]
+    with ProcessPoolExecutor(max_workers=2) as pool:
+        volumes = list(pool.map(_volume, breps))
+    assert all(TOL.is_close(v, (i + 1) ** 3) for i, v in enumerate(volumes))